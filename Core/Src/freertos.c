@@ -24,6 +24,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "eboard.h"
 
 /* USER CODE END Includes */
 
@@ -52,6 +53,31 @@
 
 /* USER CODE END FunctionPrototypes */
 
+/* Hook prototypes */
+void vApplicationIdleHook(void);
+void vApplicationStackOverflowHook(xTaskHandle xTask, signed char *pcTaskName);
+
+/* USER CODE BEGIN 2 */
+void vApplicationIdleHook( void )
+{
+  /* Records logged from interrupts are formatted here, from task context and
+  only when no other task is ready to run. */
+  eboard_log_flush();
+}
+/* USER CODE END 2 */
+
+/* USER CODE BEGIN 4 */
+void vApplicationStackOverflowHook(xTaskHandle xTask, signed char *pcTaskName)
+{
+  /* Called on a context switch out of a task whose stack overflowed or whose
+  last words were overwritten (configCHECK_FOR_STACK_OVERFLOW 2). Nothing can
+  be trusted past this point: stop here, the debugger shows pcTaskName. */
+  (void)xTask;
+  (void)pcTaskName;
+  configASSERT(0);
+}
+/* USER CODE END 4 */
+
 /* GetIdleTaskMemory prototype (linked to static allocation support) */
 void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize );
 
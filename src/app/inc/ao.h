@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : ao.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef APP_INC_AO_H_
+#define APP_INC_AO_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driver.h"
+#include "epool.h"
+
+/********************** macros ***********************************************/
+
+#define AO_MAX         8  // Active objects in the system, at most 32
+#define AO_SIGNAL_MAX  16 // Signals that can be published
+
+// Delivered once by the thread before any other event
+#define AO_SIG_START   ((ao_signal_t) 0xffff)
+
+// Delivered after every wake-up, once the pending events have all been
+// handled: state folded over a batch can be applied here, once.
+#define AO_SIG_FLUSH   ((ao_signal_t) 0xfffe)
+
+// Notification bit telling the thread that its queue has events
+#define AO_NOTIFY_QUEUE (1u << 31)
+
+#define AO_DEFINE_(name_, handler_, priority_, queue_len_, stack_depth_, keep_newest_) \
+  static const ao_event_t *name_##_queue_[queue_len_]; \
+  static StackType_t name_##_stack_[stack_depth_]; \
+  ao_t name_ = { name: #name_, handler: handler_, priority: priority_, \
+      queue_storage: name_##_queue_, queue_len: queue_len_, \
+      stack: name_##_stack_, stack_depth: stack_depth_, \
+      keep_newest: keep_newest_ }
+
+// Defines the active object "name_", with a queue of queue_len_ events and a
+// stack of stack_depth_ words. Storage is static, ao_start() runs it.
+#define AO_DEFINE(name_, handler_, priority_, queue_len_, stack_depth_) \
+  AO_DEFINE_(name_, handler_, priority_, queue_len_, stack_depth_, false)
+
+// Same, but a post to a full queue drops the oldest pending event instead of
+// the new one: the newest state always gets through.
+#define AO_DEFINE_LATEST(name_, handler_, priority_, queue_len_, stack_depth_) \
+  AO_DEFINE_(name_, handler_, priority_, queue_len_, stack_depth_, true)
+
+/********************** typedef **********************************************/
+
+typedef uint16_t ao_signal_t;
+
+// Base of every event, derived events embed it as the first member.
+// Constant events have no pool; pool events are reference counted and go
+// back to their pool once the last receiver has handled them.
+typedef struct
+{
+  ao_signal_t sig;
+  volatile uint16_t refs;
+  epool_t *pool;
+} ao_event_t;
+
+typedef struct ao_s ao_t;
+
+// Runs to completion in the thread of the active object.
+typedef void
+(*ao_handler_t) (ao_t *ao, const ao_event_t *event);
+
+typedef struct
+{
+  uint32_t posts;
+  uint32_t drops;    // Posts refused by a full queue
+  uint32_t replaced; // Oldest pending events dropped for a newer one
+  UBaseType_t depth; // Deepest queue seen after a post
+  uint32_t batches;  // Wake-ups that found queued events
+  uint32_t batched;  // Queued events handled over those wake-ups
+  uint32_t batch_max;
+} ao_stats_t;
+
+struct ao_s
+{
+  const char *name;
+  ao_handler_t handler;
+  UBaseType_t priority;
+  const ao_event_t **queue_storage;
+  UBaseType_t queue_len;
+  StackType_t *stack;
+  uint32_t stack_depth;
+  bool keep_newest;
+
+  uint8_t id;
+  QueueHandle_t queue;
+  StaticQueue_t queue_buffer;
+  TaskHandle_t task;
+  StaticTask_t task_buffer;
+  ao_stats_t stats;
+};
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void
+ao_start (ao_t *ao);
+
+ao_event_t*
+ao_event_new (epool_t *pool, ao_signal_t sig);
+
+bool
+ao_post (ao_t *ao, const ao_event_t *event);
+
+bool
+ao_post_from_isr (ao_t *ao, const ao_event_t *event,
+		  BaseType_t *higher_priority_task_woken);
+
+void
+ao_subscribe (ao_t *ao, ao_signal_t sig);
+
+void
+ao_publish (const ao_event_t *event);
+
+void
+ao_stats (const ao_t *ao, ao_stats_t *stats);
+
+void
+AoCommand (int argc, char *argv[]);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_INC_AO_H_ */
+/********************** end of file ******************************************/
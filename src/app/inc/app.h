@@ -49,19 +49,53 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "ao.h"
+
 /********************** macros ***********************************************/
 
 #define SHORT_TIME 100
 #define LONG_TIME  2000
 #define STUCK_TIME 8000
 
+// Gestures, see gesture.h
+// Max release time between clicks of a multi-click. A click is reported
+// once it has run out, so a SHORT reaches the led this much after release.
+#define CLICK_GAP_TIME 300
+#define REPEAT_TIME    500  // Auto-repeat period of a hold, from LONG_TIME on
+#define CHORD_TIME     100  // Max delay between the presses of a chord
+
+// ms between debounce samples, a change is accepted after the fixed
+// EDEBOUNCE_SAMPLES (4) of them, 20 ms
+#define DEBOUNCE_PERIOD 5
+
+// Button events pending for the led, see task_led.c
+#define LED_QUEUE_LEN 10
+
+// ehsm instance ids, they tell the machines apart in the flight records
+#define HSM_ID_LED     0x01
+#define HSM_ID_GESTURE 0x10 // Plus the input index
+
+// Toggle the blue led each time the leds change, to measure the edge to
+// output latency with a scope against the button pin. See also "lat".
+// #define APP_CONFIG_LATENCY_GPIO
+
 /********************** typedef **********************************************/
 typedef enum
 {
-  NONE, SHORT, LONG, STUCK,
+  NONE, SHORT, LONG, STUCK, DOUBLE, TRIPLE, REPEAT, CHORD, EVENT_TYPE__CNT,
 } EventType_t;
 
-typedef uint32_t ButtonTime_t;
+typedef uint64_t ButtonTime_t; // ms, from eboard_time_ms()
+
+// Published by the button service, the signal is the EventType_t.
+typedef struct
+{
+  ao_event_t super;
+  eboard_gpio_idx_t idx;
+  ButtonTime_t time; // Source: the input edge or the timeout behind it,
+		     // the last release edge for SHORT, DOUBLE and TRIPLE
+  uint32_t seq;      // One more for every published button event
+} ButtonEvent_t;
 /********************** external data declaration ****************************/
 
 /********************** external functions declaration ***********************/
@@ -69,11 +103,11 @@ typedef uint32_t ButtonTime_t;
 void
 app_init (void);
 
-BaseType_t
-push_led_event (EventType_t *event);
+void
+HeapCommand (int argc, char *argv[]);
 
-EventType_t*
-pop_led_event (void);
+void
+StackCommand (int argc, char *argv[]);
 
 /********************** End of CPP guard *************************************/
 #ifdef __cplusplus
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : button.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef APP_INC_BUTTON_H_
+#define APP_INC_BUTTON_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "app.h"
+#include "edebounce.h"
+#include "gesture.h"
+
+/********************** macros ***********************************************/
+
+#define BUTTON_INPUTS_MAX 8 // Input indexes a service can handle
+
+/********************** typedef **********************************************/
+
+typedef struct Button_s
+{
+  eboard_gpio_idx_t idx;
+  void
+  (*on_event) (eboard_gpio_idx_t idx, EventType_t event_type,
+	       ButtonTime_t time);
+
+  bool pressed;
+  bool settling;
+  ButtonTime_t edge_time;
+  Gesture_t gesture;
+
+  // Deadline queue link, sorted by deadline
+  bool scheduled;
+  ButtonTime_t deadline;
+  struct Button_s *next;
+} Button_t;
+
+// Classifier of the button service, free of HAL and kernel calls: the task
+// and the host replay harness feed it the same way.
+typedef struct
+{
+  Button_t *by_idx[BUTTON_INPUTS_MAX];
+  Button_t *deadline_head;
+  Button_t *last_press;
+  edebounce_t debounce;
+  uint32_t settling; // Inputs with an edge not yet debounced
+
+  // Sampled input blocks, see ButtonServiceSamples()
+  uint32_t levels;   // Last sample seen
+  uint32_t phase;    // Samples until the next one is debounced
+} ButtonService_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void
+ButtonServiceInit (ButtonService_t *service, Button_t *buttons, size_t cnt,
+		   uint32_t levels, ButtonTime_t now);
+
+bool
+ButtonServiceEdge (ButtonService_t *service, eboard_gpio_idx_t idx,
+		   ButtonTime_t time);
+
+bool
+ButtonServiceIsSampling (const ButtonService_t *service);
+
+void
+ButtonServiceSample (ButtonService_t *service, uint32_t levels,
+		     ButtonTime_t now);
+
+bool
+ButtonServiceDeadline (const ButtonService_t *service,
+		       ButtonTime_t *deadline);
+
+void
+ButtonServiceTimeout (ButtonService_t *service, ButtonTime_t now);
+
+void
+ButtonServiceSamples (ButtonService_t *service, const uint32_t *samples,
+		      size_t count, ButtonTime_t time);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_INC_BUTTON_H_ */
+/********************** end of file ******************************************/
@@ -52,6 +52,11 @@ extern "C" {
 #include "hal.h"
 
 #define EBOARD_CONFIG_VERBOSE
+// Inputs sampled by TIM8 + DMA2 at 1 kHz instead of EXTI interrupts. The
+// samples feed the debouncer directly, but the half and full transfer
+// interrupts cost 62.5 IRQ/s even while the inputs are idle; EXTI costs
+// nothing then, and one interrupt per edge of a bounce burst.
+// #define EBOARD_CONFIG_INPUT_DMA
 #include "eboard.h"
 
 /********************** macros ***********************************************/
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : gesture.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef APP_INC_GESTURE_H_
+#define APP_INC_GESTURE_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app.h"
+#include "ehsm.h"
+
+/********************** macros ***********************************************/
+
+
+/********************** typedef **********************************************/
+
+typedef enum
+{
+  GESTURE_IDLE,
+  GESTURE_HELD,    // Parent of PRESSED, REPEAT and STUCK
+  GESTURE_PRESSED,
+  GESTURE_REPEAT,
+  GESTURE_STUCK,
+  GESTURE_GAP,
+  GESTURE_CHORD,
+  GESTURE__CNT,
+} GestureState_t;
+
+typedef enum
+{
+  GESTURE_SIG_PRESS,
+  GESTURE_SIG_RELEASE_NOISE, // Released before SHORT_TIME
+  GESTURE_SIG_RELEASE_SHORT, // Released before LONG_TIME
+  GESTURE_SIG_RELEASE_LONG,  // Released before STUCK_TIME
+  GESTURE_SIG_RELEASE_STUCK, // Released after STUCK_TIME
+  GESTURE_SIG_HOLD,          // Timer: next auto-repeat
+  GESTURE_SIG_STUCK,         // Timer: STUCK_TIME reached
+  GESTURE_SIG_GAP,           // Timer: no further click
+  GESTURE_SIG_CHORD,         // Pressed together with another button
+  GESTURE_SIG__CNT,
+} GestureSignal_t;
+
+// Runtime thresholds in ms, the app.h macros are the defaults
+typedef struct
+{
+  uint32_t short_time;
+  uint32_t long_time;
+  uint32_t stuck_time;
+  uint32_t click_gap_time;
+  uint32_t repeat_time;
+  uint32_t chord_time;
+} GestureThresholds_t;
+
+typedef struct
+{
+  ehsm_t hsm;
+  uint8_t clicks;
+  ButtonTime_t press_time;
+  ButtonTime_t click_time; // Release edge of the last click, the source of
+			   // the click event reported after the gap
+
+  // Single timer, the owner schedules it and feeds back timer_signal
+  bool timer_armed;
+  ButtonTime_t deadline;
+  GestureSignal_t timer_signal;
+
+  // time is the source of the event: the edge or timeout being dispatched,
+  // or click_time for the click events
+  void
+  (*emit) (void *ctx, EventType_t event_type, ButtonTime_t time);
+  void *ctx;
+} Gesture_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void
+GestureInit (Gesture_t *gesture, uint8_t id, void
+(*emit) (void *ctx, EventType_t event_type, ButtonTime_t time),
+	     void *ctx);
+
+bool
+GestureIsPressed (const Gesture_t *gesture);
+
+void
+GestureThresholdsGet (GestureThresholds_t *th);
+
+bool
+GestureThresholdsSet (const GestureThresholds_t *th);
+
+void
+GesturePress (Gesture_t *gesture, ButtonTime_t time);
+
+void
+GestureRelease (Gesture_t *gesture, ButtonTime_t time);
+
+void
+GestureTimeout (Gesture_t *gesture, ButtonTime_t time);
+
+void
+GestureChord (Gesture_t *gesture, ButtonTime_t time);
+
+void
+GestureDispatch (Gesture_t *gesture, GestureSignal_t signal,
+		 ButtonTime_t time);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_INC_GESTURE_H_ */
+/********************** end of file ******************************************/
@@ -49,17 +49,27 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "epool.h"
+
 /********************** macros ***********************************************/
 
 /********************** typedef **********************************************/
 
 /********************** external data declaration ****************************/
 
+extern epool_t button_event_pool;
+
 /********************** external functions declaration ***********************/
 
 void
 task_ButtonEvent (void *pvParameters);
 
+void
+ButtonThresholdsCommand (int argc, char *argv[]);
+
+void
+ButtonRecorderCommand (int argc, char *argv[]);
+
 /********************** End of CPP guard *************************************/
 #ifdef __cplusplus
 }
@@ -49,6 +49,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "ao.h"
 #include "app.h"
 
 /********************** macros ***********************************************/
@@ -57,10 +58,13 @@ extern "C" {
 
 /********************** external data declaration ****************************/
 
+// Drives the leds from the button events it subscribes to
+extern ao_t ao_LedEvent;
+
 /********************** external functions declaration ***********************/
 
 void
-task_LedEvent (void *arguments);
+LedLatencyCommand (int argc, char *argv[]);
 
 /********************** End of CPP guard *************************************/
 #ifdef __cplusplus
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : ao.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driver.h"
+#include "econsole.h"
+#include "ao.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static void
+ao_thread (void *arguments);
+
+static void
+ao_record_post (ao_t *ao, BaseType_t status, UBaseType_t depth);
+
+static void
+ao_event_ref (const ao_event_t *event);
+
+static void
+ao_event_release (const ao_event_t *event);
+
+static const ao_event_t*
+ao_push_newest (ao_t *ao, const ao_event_t *event, UBaseType_t *depth);
+
+static const ao_event_t*
+ao_push_newest_from_isr (ao_t *ao, const ao_event_t *event,
+			 UBaseType_t *depth,
+			 BaseType_t *higher_priority_task_woken);
+
+/********************** internal data definition *****************************/
+
+static const ao_event_t ao_start_event =
+  { sig: AO_SIG_START };
+
+static const ao_event_t ao_flush_event =
+  { sig: AO_SIG_FLUSH };
+
+// Every started active object, by id
+static ao_t *ao_registry[AO_MAX];
+static uint8_t ao_cnt = 0;
+
+// Subscribers of each signal, one bit per active object id
+static volatile uint32_t ao_subscribers[AO_SIGNAL_MAX];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void
+ao_thread (void *arguments)
+{
+  ao_t *ao = (ao_t*) arguments;
+  const ao_event_t *event;
+
+  ao->handler (ao, &ao_start_event);
+  while (true)
+    {
+      uint32_t bits;
+      xTaskNotifyWait (0, UINT32_MAX, &bits, portMAX_DELAY);
+
+      // Drain the whole queue in this wake-up, then report the batch.
+      if (0 != (bits & AO_NOTIFY_QUEUE))
+	{
+	  uint32_t batch = 0;
+	  while (pdPASS == xQueueReceive (ao->queue, &event, 0))
+	    {
+	      ao->handler (ao, event);
+	      ao_event_release (event);
+	      batch++;
+	    }
+
+	  if (0 < batch)
+	    {
+	      taskENTER_CRITICAL();
+	      ao->stats.batches++;
+	      ao->stats.batched += batch;
+	      if (ao->stats.batch_max < batch)
+		{
+		  ao->stats.batch_max = batch;
+		}
+	      taskEXIT_CRITICAL();
+	    }
+	}
+
+      ao->handler (ao, &ao_flush_event);
+    }
+}
+
+static void
+ao_record_post (ao_t *ao, BaseType_t status, UBaseType_t depth)
+{
+  // Posters may preempt each other, the counters are only statistics.
+  ao->stats.posts++;
+  if (pdPASS != status)
+    {
+      ao->stats.drops++;
+    }
+  else if (ao->stats.depth < depth)
+    {
+      ao->stats.depth = depth;
+    }
+}
+
+// The reference count is touched from tasks and interrupts, the FROM_ISR
+// critical section masks the kernel interrupts from both.
+static void
+ao_event_ref (const ao_event_t *event)
+{
+  if (NULL == event->pool)
+    {
+      return;
+    }
+
+  UBaseType_t state = taskENTER_CRITICAL_FROM_ISR();
+  ((ao_event_t*) event)->refs++;
+  taskEXIT_CRITICAL_FROM_ISR(state);
+}
+
+static void
+ao_event_release (const ao_event_t *event)
+{
+  if (NULL == event->pool)
+    {
+      return;
+    }
+
+  UBaseType_t state = taskENTER_CRITICAL_FROM_ISR();
+  uint16_t refs = --((ao_event_t*) event)->refs;
+  taskEXIT_CRITICAL_FROM_ISR(state);
+
+  if (0 == refs)
+    {
+      epool_free (event->pool, (void*) event);
+    }
+}
+
+// Queue the event, taking out the oldest pending one first when the queue
+// is full, and return that one, NULL if there was room. Both steps run in
+// one critical section so that the displaced event is released exactly once.
+static const ao_event_t*
+ao_push_newest (ao_t *ao, const ao_event_t *event, UBaseType_t *depth)
+{
+  const ao_event_t *old = NULL;
+
+  taskENTER_CRITICAL();
+  if ((0 == uxQueueSpacesAvailable (ao->queue))
+      && (pdPASS != xQueueReceive (ao->queue, &old, 0)))
+    {
+      old = NULL;
+    }
+  xQueueSend(ao->queue, &event, 0);
+  *depth = uxQueueMessagesWaiting (ao->queue);
+  taskEXIT_CRITICAL();
+  return old;
+}
+
+static const ao_event_t*
+ao_push_newest_from_isr (ao_t *ao, const ao_event_t *event,
+			 UBaseType_t *depth,
+			 BaseType_t *higher_priority_task_woken)
+{
+  const ao_event_t *old = NULL;
+
+  UBaseType_t state = taskENTER_CRITICAL_FROM_ISR();
+  if ((pdFALSE != xQueueIsQueueFullFromISR (ao->queue))
+      && (pdPASS
+	  != xQueueReceiveFromISR (ao->queue, &old,
+				   higher_priority_task_woken)))
+    {
+      old = NULL;
+    }
+  xQueueSendFromISR(ao->queue, &event, higher_priority_task_woken);
+  *depth = uxQueueMessagesWaitingFromISR (ao->queue);
+  taskEXIT_CRITICAL_FROM_ISR(state);
+  return old;
+}
+
+/********************** external functions definition ************************/
+
+void
+ao_start (ao_t *ao)
+{
+  assert(ao_cnt < AO_MAX);
+
+  ao->id = ao_cnt;
+  ao->queue = xQueueCreateStatic(ao->queue_len, sizeof(const ao_event_t*),
+				 (uint8_t* ) ao->queue_storage,
+				 &ao->queue_buffer);
+  assert(NULL != ao->queue);
+  ao_registry[ao_cnt++] = ao;
+
+  ao->task = xTaskCreateStatic (ao_thread, ao->name, ao->stack_depth, ao,
+				ao->priority, ao->stack, &ao->task_buffer);
+  assert(NULL != ao->task);
+}
+
+/**
+ * Take an event from the pool, NULL when it is exhausted. The event must
+ * then be posted or published, which hands it over to the receivers.
+ */
+ao_event_t*
+ao_event_new (epool_t *pool, ao_signal_t sig)
+{
+  ao_event_t *event = epool_alloc (pool);
+  if (NULL != event)
+    {
+      event->sig = sig;
+      event->refs = 0;
+      event->pool = pool;
+    }
+  return event;
+}
+
+/**
+ * Queue an event for the active object, never blocks: a full queue drops
+ * the event and counts it, or with keep_newest drops its oldest event.
+ */
+bool
+ao_post (ao_t *ao, const ao_event_t *event)
+{
+  ao_event_ref (event);
+  if (ao->keep_newest)
+    {
+      UBaseType_t depth;
+      const ao_event_t *old = ao_push_newest (ao, event, &depth);
+      xTaskNotify(ao->task, AO_NOTIFY_QUEUE, eSetBits);
+      ao_record_post (ao, pdPASS, depth);
+      if (NULL != old)
+	{
+	  ao->stats.replaced++;
+	  ao_event_release (old);
+	}
+      return true;
+    }
+
+  BaseType_t status = xQueueSend(ao->queue, &event, 0);
+  ao_record_post (ao, status, uxQueueMessagesWaiting (ao->queue));
+  if (pdPASS == status)
+    {
+      xTaskNotify(ao->task, AO_NOTIFY_QUEUE, eSetBits);
+    }
+  else
+    {
+      ao_event_release (event);
+    }
+  return pdPASS == status;
+}
+
+bool
+ao_post_from_isr (ao_t *ao, const ao_event_t *event,
+		  BaseType_t *higher_priority_task_woken)
+{
+  ao_event_ref (event);
+  if (ao->keep_newest)
+    {
+      UBaseType_t depth;
+      const ao_event_t *old = ao_push_newest_from_isr (
+	  ao, event, &depth, higher_priority_task_woken);
+      xTaskNotifyFromISR(ao->task, AO_NOTIFY_QUEUE, eSetBits,
+			 higher_priority_task_woken);
+      ao_record_post (ao, pdPASS, depth);
+      if (NULL != old)
+	{
+	  ao->stats.replaced++;
+	  ao_event_release (old);
+	}
+      return true;
+    }
+
+  BaseType_t status = xQueueSendFromISR(ao->queue, &event,
+					higher_priority_task_woken);
+  ao_record_post (ao, status, uxQueueMessagesWaitingFromISR (ao->queue));
+  if (pdPASS == status)
+    {
+      xTaskNotifyFromISR(ao->task, AO_NOTIFY_QUEUE, eSetBits,
+			 higher_priority_task_woken);
+    }
+  else
+    {
+      ao_event_release (event);
+    }
+  return pdPASS == status;
+}
+
+void
+ao_subscribe (ao_t *ao, ao_signal_t sig)
+{
+  assert(sig < AO_SIGNAL_MAX);
+
+  taskENTER_CRITICAL();
+  ao_subscribers[sig] |= 1u << ao->id;
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * Post the event to every subscriber of its signal, from task context. Each
+ * subscriber gets the same event by reference, a pool event is freed once
+ * the last of them has handled it, or right away when nobody subscribed.
+ */
+void
+ao_publish (const ao_event_t *event)
+{
+  assert(event->sig < AO_SIGNAL_MAX);
+
+  // Hold the event while posting, a fast subscriber must not free it early.
+  ao_event_ref (event);
+
+  uint32_t subscribers = ao_subscribers[event->sig];
+  while (0 != subscribers)
+    {
+      uint32_t id = __builtin_ctz (subscribers);
+      subscribers &= subscribers - 1;
+      ao_post (ao_registry[id], event);
+    }
+
+  ao_event_release (event);
+}
+
+void
+ao_stats (const ao_t *ao, ao_stats_t *stats)
+{
+  taskENTER_CRITICAL();
+  *stats = ao->stats;
+  taskEXIT_CRITICAL();
+}
+
+void
+AoCommand (int argc, char *argv[])
+{
+  for (uint8_t id = 0; id < ao_cnt; id++)
+    {
+      ao_t *ao = ao_registry[id];
+      ao_stats_t stats;
+
+      ao_stats (ao, &stats);
+      econsole_printf (
+	  "%s: prio %lu, %lu posts, %lu drops, %lu replaced, "
+	  "depth %lu/%lu\r\n",
+	  ao->name, ao->priority, stats.posts, stats.drops, stats.replaced,
+	  stats.depth, ao->queue_len);
+      econsole_printf ("%s: %lu events in %lu batches, largest %lu\r\n",
+		       ao->name, stats.batched, stats.batches,
+		       stats.batch_max);
+    }
+}
+
+/********************** end of file ******************************************/
@@ -43,52 +43,132 @@
 #include <stdbool.h>
 
 #include "driver.h"
+#include "econsole.h"
+#include "ao.h"
 #include "app.h"
 #include "task_button.h"
+#include "task_console.h"
 #include "task_led.h"
 
 /********************** macros and definitions *******************************/
 
+// Static stack and control block of an entry of app_tasks[]
+#define APP_TASK_STORAGE(function_, stack_depth_) \
+  static StackType_t function_##_stack[stack_depth_]; \
+  static StaticTask_t function_##_tcb
+
+#define APP_TASK(function_, priority_) \
+  { function: function_, name: #function_, stack: function_##_stack, \
+    stack_depth: sizeof(function_##_stack) / sizeof(StackType_t), \
+    tcb: &function_##_tcb, priority: priority_ }
+
+typedef struct
+{
+  TaskFunction_t function;
+  const char *name;
+  StackType_t *stack;
+  uint32_t stack_depth;
+  StaticTask_t *tcb;
+  UBaseType_t priority;
+} AppTask_t;
+
+typedef struct
+{
+  ao_t *ao;
+  ao_signal_t sig;
+} AppSubscription_t;
+
 /********************** internal data declaration ****************************/
 
 /********************** internal functions declaration ***********************/
 
 /********************** internal data definition *****************************/
 
+// Everything the application runs, all of it allocated at link time: the
+// kernel heap is not even built (configSUPPORT_DYNAMIC_ALLOCATION is 0).
+
+// task_ButtonEvent logs (ELOG, eboard_log_flush, eformat) and publishes
+// from the gesture and ehsm handlers; see "stack" for the used depth.
+APP_TASK_STORAGE(task_ButtonEvent, 256);
+APP_TASK_STORAGE(task_Console, 256);
+
+static const AppTask_t app_tasks[] =
+  {
+    APP_TASK(task_ButtonEvent, tskIDLE_PRIORITY),
+    APP_TASK(task_Console, tskIDLE_PRIORITY), };
+
+static ao_t *const app_aos[] =
+  { &ao_LedEvent, };
+
+// Block pools, reported by "heap"
+static const epool_t *const app_pools[] =
+  { &button_event_pool, };
+
+static const AppSubscription_t app_subscriptions[] =
+  {
+    { ao: &ao_LedEvent, sig: NONE },
+    { ao: &ao_LedEvent, sig: SHORT },
+    { ao: &ao_LedEvent, sig: LONG },
+    { ao: &ao_LedEvent, sig: STUCK },
+    { ao: &ao_LedEvent, sig: DOUBLE },
+    { ao: &ao_LedEvent, sig: TRIPLE },
+    { ao: &ao_LedEvent, sig: REPEAT },
+    { ao: &ao_LedEvent, sig: CHORD }, };
+
+#define APP_CNT(table) (sizeof(table) / sizeof(table[0]))
+
+static TaskHandle_t app_task_handles[APP_CNT(app_tasks)];
+
 /********************** external data definition *****************************/
 
 /********************** internal functions definition ************************/
 
-// Define the queue handle
-QueueHandle_t led_events_queue;
+/********************** external functions definition ************************/
 
-/**
- * This function push a pointer event into the queue.
- * If the send fails, the caller is responsible to free the memory.
- * If the event is succefully pushed, the receiver is in charge of
- * freeing the memory.
- */
-BaseType_t
-push_led_event (EventType_t *event)
+// There is no kernel heap to report, the dynamic allocations of the
+// application are the blocks of its pools.
+void
+HeapCommand (int argc, char *argv[])
 {
-  return xQueueSend(led_events_queue, &event, portMAX_DELAY);
+  econsole_printf ("heap: none, static allocation only\r\n");
+  for (uint32_t i = 0; i < APP_CNT(app_pools); i++)
+    {
+      const epool_t *pool = app_pools[i];
+      epool_stats_t stats;
+
+      epool_stats (pool, &stats);
+      econsole_printf ("%s: %u/%u blocks of %u, peak %u, %lu fails, "
+		       "%lu bad frees\r\n", pool->label, stats.in_use,
+		       pool->count, pool->block_size, stats.peak, stats.fails,
+		       stats.bad_frees);
+    }
 }
 
-/**
- * Get a pointer to an event, the caller of this function must
- * free the memory.
- */
-EventType_t*
-pop_led_event (void)
+// Used stack of every task: its depth less the high water mark, the words
+// never written since the task started.
+void
+StackCommand (int argc, char *argv[])
 {
-  EventType_t *event;
-  // Receive data from the queue
-  xQueueReceive (led_events_queue, &event, portMAX_DELAY);
-  return event;
+  for (uint32_t i = 0; i < APP_CNT(app_tasks); i++)
+    {
+      uint32_t depth = app_tasks[i].stack_depth;
+      econsole_printf ("%s: %lu/%lu words\r\n", app_tasks[i].name,
+		       depth - uxTaskGetStackHighWaterMark (app_task_handles[i]),
+		       depth);
+    }
+  for (uint32_t i = 0; i < APP_CNT(app_aos); i++)
+    {
+      uint32_t depth = app_aos[i]->stack_depth;
+      econsole_printf ("%s: %lu/%lu words\r\n", app_aos[i]->name,
+		       depth - uxTaskGetStackHighWaterMark (app_aos[i]->task),
+		       depth);
+    }
+  econsole_printf ("IDLE: %lu/%lu words\r\n",
+		   (uint32_t) (configMINIMAL_STACK_SIZE
+		       - uxTaskGetStackHighWaterMark (xTaskGetIdleTaskHandle ())),
+		   (uint32_t) configMINIMAL_STACK_SIZE);
 }
 
-/********************** external functions definition ************************/
-
 void
 app_init (void)
 {
@@ -97,29 +177,29 @@ app_init (void)
       eboard_init ();
     }
 
-  // Queue
-
-  // Create a queue with a capacity of 10 events
-  led_events_queue = xQueueCreate(10, sizeof(EventType_t*));
-
-  assert(led_events_queue != NULL);
+  // active objects, subscribed before any event can be published
+    {
+      for (uint32_t i = 0; i < APP_CNT(app_subscriptions); i++)
+	{
+	  ao_subscribe (app_subscriptions[i].ao, app_subscriptions[i].sig);
+	}
+      for (uint32_t i = 0; i < APP_CNT(app_aos); i++)
+	{
+	  ao_start (app_aos[i]);
+	}
+    }
 
   // tasks
     {
-      BaseType_t status;
-      status = xTaskCreate (task_ButtonEvent, "task_ButtonEvent", 128, NULL,
-      tskIDLE_PRIORITY,
-			    NULL);
-      assert(status == pdPASS);
-
-      status = xTaskCreate (task_LedEvent, "task_LedEvent", 128, NULL,
-      tskIDLE_PRIORITY,
-			    NULL);
-      assert(status == pdPASS);
-
-      while (pdPASS != status)
+      for (uint32_t i = 0; i < APP_CNT(app_tasks); i++)
 	{
-	  // error
+	  const AppTask_t *task = &app_tasks[i];
+	  TaskHandle_t handle = xTaskCreateStatic (task->function, task->name,
+						   task->stack_depth, NULL,
+						   task->priority, task->stack,
+						   task->tcb);
+	  assert(NULL != handle);
+	  app_task_handles[i] = handle;
 	}
     }
 }
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : button.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "driver.h"
+#include "button.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static void
+GestureEmit (void *ctx, EventType_t event_type, ButtonTime_t time);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void
+DeadlineCancel (ButtonService_t *service, Button_t *button)
+{
+  if (!button->scheduled)
+    {
+      return;
+    }
+
+  Button_t **link = &service->deadline_head;
+  while (*link != button)
+    {
+      link = &(*link)->next;
+    }
+  *link = button->next;
+  button->scheduled = false;
+}
+
+static void
+DeadlineSchedule (ButtonService_t *service, Button_t *button,
+		  ButtonTime_t deadline)
+{
+  DeadlineCancel (service, button);
+
+  Button_t **link = &service->deadline_head;
+  while ((NULL != *link) && ((*link)->deadline <= deadline))
+    {
+      link = &(*link)->next;
+    }
+  button->deadline = deadline;
+  button->next = *link;
+  button->scheduled = true;
+  *link = button;
+}
+
+static void
+GestureEmit (void *ctx, EventType_t event_type, ButtonTime_t time)
+{
+  Button_t *button = (Button_t*) ctx;
+  button->on_event (button->idx, event_type, time);
+}
+
+// Mirror the gesture timer in the deadline queue.
+static void
+GestureSync (ButtonService_t *service, Button_t *button)
+{
+  if (button->gesture.timer_armed)
+    {
+      DeadlineSchedule (service, button, button->gesture.deadline);
+    }
+  else
+    {
+      DeadlineCancel (service, button);
+    }
+}
+
+static void
+OnPress (ButtonService_t *service, Button_t *button)
+{
+  Button_t *other = service->last_press;
+  GestureThresholds_t th;
+
+  GestureThresholdsGet (&th);
+  button->pressed = true;
+  service->last_press = button;
+
+  // Chord: pressed shortly after another button that is still held and not
+  // yet classified.
+  if ((NULL != other) && (other != button) && other->pressed
+      && GestureIsPressed (&other->gesture)
+      && ((button->edge_time - other->gesture.press_time) <= th.chord_time))
+    {
+      GestureChord (&other->gesture, button->edge_time);
+      GestureChord (&button->gesture, button->edge_time);
+      GestureSync (service, other);
+    }
+  else
+    {
+      GesturePress (&button->gesture, button->edge_time);
+    }
+  GestureSync (service, button);
+}
+
+static void
+OnRelease (ButtonService_t *service, Button_t *button)
+{
+  button->pressed = false;
+  GestureRelease (&button->gesture, button->edge_time);
+  GestureSync (service, button);
+}
+
+/********************** external functions definition ************************/
+
+/**
+ * Takes the buttons in, with their idx and on_event set, and classifies
+ * the inputs already pressed in levels as pressed at now.
+ */
+void
+ButtonServiceInit (ButtonService_t *service, Button_t *buttons, size_t cnt,
+		   uint32_t levels, ButtonTime_t now)
+{
+  memset (service, 0, sizeof(*service));
+  edebounce_init (&service->debounce, levels);
+  service->levels = levels;
+
+  for (size_t i = 0; i < cnt; i++)
+    {
+      Button_t *button = buttons + i;
+      service->by_idx[button->idx] = button;
+      button->pressed = false;
+      button->settling = false;
+      button->scheduled = false;
+      button->edge_time = now;
+      GestureInit (&button->gesture, HSM_ID_GESTURE + button->idx,
+		   GestureEmit, button);
+      if (levels & (1u << button->idx))
+	{
+	  OnPress (service, button);
+	}
+    }
+}
+
+/**
+ * Raw edge of an input: dates the change the debouncer may accept later,
+ * with the first edge of its burst. Returns true when it starts the
+ * sampling, the first sample is then due right away.
+ */
+bool
+ButtonServiceEdge (ButtonService_t *service, eboard_gpio_idx_t idx,
+		   ButtonTime_t time)
+{
+  Button_t *button = (idx < BUTTON_INPUTS_MAX) ? service->by_idx[idx] : NULL;
+  if ((NULL == button) || button->settling)
+    {
+      return false;
+    }
+
+  bool started = !ButtonServiceIsSampling (service);
+  button->settling = true;
+  button->edge_time = time;
+  service->settling |= (1u << idx);
+  return started;
+}
+
+/**
+ * True while samples are needed, one every DEBOUNCE_PERIOD: an edge is not
+ * debounced yet or a change is being counted.
+ */
+bool
+ButtonServiceIsSampling (const ButtonService_t *service)
+{
+  return (0 != service->settling)
+      || !edebounce_is_settled (&service->debounce);
+}
+
+/**
+ * One debounce sample of every input, bit n is the level of input n. Runs
+ * the presses and releases it accepts.
+ */
+void
+ButtonServiceSample (ButtonService_t *service, uint32_t levels,
+		     ButtonTime_t now)
+{
+  uint32_t toggled = edebounce_sample (&service->debounce, levels);
+  uint32_t done = service->settling & ~edebounce_pending (&service->debounce);
+
+  for (uint32_t mask = toggled; 0 != mask; mask &= (mask - 1))
+    {
+      uint32_t idx = __builtin_ctz (mask);
+      Button_t *button = service->by_idx[idx];
+      if ((idx >= BUTTON_INPUTS_MAX) || (NULL == button))
+	{
+	  continue;
+	}
+      if (!button->settling)
+	{
+	  // Its edge was dropped, date the change with this sample
+	  button->edge_time = now;
+	}
+      if (button->pressed)
+	{
+	  OnRelease (service, button);
+	}
+      else
+	{
+	  OnPress (service, button);
+	}
+    }
+
+  for (uint32_t mask = done; 0 != mask; mask &= (mask - 1))
+    {
+      service->by_idx[__builtin_ctz (mask)]->settling = false;
+    }
+  service->settling &= ~done;
+}
+
+/**
+ * Earliest pending gesture deadline, false when there is none.
+ */
+bool
+ButtonServiceDeadline (const ButtonService_t *service, ButtonTime_t *deadline)
+{
+  if (NULL == service->deadline_head)
+    {
+      return false;
+    }
+  *deadline = service->deadline_head->deadline;
+  return true;
+}
+
+/**
+ * Serves every gesture deadline reached at now, earliest first.
+ */
+void
+ButtonServiceTimeout (ButtonService_t *service, ButtonTime_t now)
+{
+  while ((NULL != service->deadline_head)
+      && (service->deadline_head->deadline <= now))
+    {
+      Button_t *button = service->deadline_head;
+      DeadlineCancel (service, button);
+      GestureTimeout (&button->gesture, now);
+      GestureSync (service, button);
+    }
+}
+
+/**
+ * Block of input samples taken every EBOARD_GPIO_SAMPLE_PERIOD_MS, oldest
+ * first, time is the one of the last. Stands for the edges, the debounce
+ * samples and the time of the other calls: a change between two samples is
+ * an edge, and every DEBOUNCE_PERIOD worth of samples one goes to the
+ * debouncer, the first one as soon as the sampling starts.
+ */
+void
+ButtonServiceSamples (ButtonService_t *service, const uint32_t *samples,
+		      size_t count, ButtonTime_t time)
+{
+  const uint32_t decimation = DEBOUNCE_PERIOD / EBOARD_GPIO_SAMPLE_PERIOD_MS;
+
+  for (size_t i = 0; i < count; i++)
+    {
+      ButtonTime_t now = time
+	  - ((count - 1 - i) * EBOARD_GPIO_SAMPLE_PERIOD_MS);
+      uint32_t changed = samples[i] ^ service->levels;
+
+      ButtonServiceTimeout (service, now);
+      service->levels = samples[i];
+      for (uint32_t mask = changed; 0 != mask; mask &= (mask - 1))
+	{
+	  if (ButtonServiceEdge (service, __builtin_ctz (mask), now))
+	    {
+	      service->phase = 0;
+	    }
+	}
+
+      if (!ButtonServiceIsSampling (service))
+	{
+	  continue;
+	}
+      if (0 == service->phase)
+	{
+	  service->phase = decimation;
+	  ButtonServiceSample (service, samples[i], now);
+	}
+      service->phase--;
+    }
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : gesture.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driver.h"
+#include "gesture.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+// What every action of the gesture machine gets as its event
+typedef struct
+{
+  const GestureThresholds_t *th;
+  ButtonTime_t time;
+} GestureEvent_t;
+
+/********************** internal functions declaration ***********************/
+
+static void
+EnterHeld (ehsm_t *hsm, const void *event);
+static void
+EnterPressed (ehsm_t *hsm, const void *event);
+static void
+EnterRepeat (ehsm_t *hsm, const void *event);
+static void
+EnterStuck (ehsm_t *hsm, const void *event);
+static void
+EnterGap (ehsm_t *hsm, const void *event);
+static void
+EnterChord (ehsm_t *hsm, const void *event);
+static void
+ExitChord (ehsm_t *hsm, const void *event);
+static void
+ExitTimed (ehsm_t *hsm, const void *event);
+static void
+ActionClick (ehsm_t *hsm, const void *event);
+static void
+ActionLong (ehsm_t *hsm, const void *event);
+static void
+ActionStuckRelease (ehsm_t *hsm, const void *event);
+static void
+ActionGap (ehsm_t *hsm, const void *event);
+
+/********************** internal data definition *****************************/
+
+// Published thresholds are thresholds[thresholds_seq & 1]
+static GestureThresholds_t thresholds[2] =
+  {
+    { short_time: SHORT_TIME, long_time: LONG_TIME, stuck_time: STUCK_TIME,
+	click_gap_time: CLICK_GAP_TIME, repeat_time: REPEAT_TIME, chord_time:
+	    CHORD_TIME }, };
+static volatile uint32_t thresholds_seq = 0;
+
+/**
+ * HELD groups the states where the button is down. Every state that waits
+ * on the timer disarms it on exit, entry actions arm it again.
+ */
+static const ehsm_state_t states[GESTURE__CNT] =
+  {
+    [GESTURE_IDLE] = EHSM_STATE(IDLE, EHSM_NONE, NULL, NULL),
+    [GESTURE_HELD] = EHSM_STATE(HELD, EHSM_NONE, EnterHeld, NULL),
+    [GESTURE_PRESSED] = EHSM_STATE(PRESSED, GESTURE_HELD, EnterPressed,
+				   ExitTimed),
+    [GESTURE_REPEAT] = EHSM_STATE(REPEAT, GESTURE_HELD, EnterRepeat,
+				  ExitTimed),
+    [GESTURE_STUCK] = EHSM_STATE(STUCK, GESTURE_HELD, EnterStuck, NULL),
+    [GESTURE_GAP] = EHSM_STATE(GAP, EHSM_NONE, EnterGap, ExitTimed),
+    [GESTURE_CHORD] = EHSM_STATE(CHORD, EHSM_NONE, EnterChord, ExitChord), };
+
+#define T(target, action) EHSM_TRAN(GESTURE_##target, action)
+
+/**
+ * Transition table: [state][signal] -> target state and action. Signals
+ * left out go to the parent state, and are ignored at the top.
+ */
+static const ehsm_transition_t transitions[GESTURE__CNT][GESTURE_SIG__CNT] =
+  {
+    [GESTURE_IDLE] =
+      {
+	[GESTURE_SIG_PRESS] = T(PRESSED, NULL),
+	[GESTURE_SIG_CHORD] = T(CHORD, NULL),
+      },
+    [GESTURE_HELD] =
+      {
+	[GESTURE_SIG_RELEASE_STUCK] = T(IDLE, ActionStuckRelease),
+      },
+    [GESTURE_PRESSED] =
+      {
+	[GESTURE_SIG_RELEASE_NOISE] = T(GAP, NULL),
+	[GESTURE_SIG_RELEASE_SHORT] = T(GAP, ActionClick),
+	[GESTURE_SIG_RELEASE_LONG] = T(IDLE, ActionLong),
+	[GESTURE_SIG_HOLD] = T(REPEAT, NULL),
+	[GESTURE_SIG_STUCK] = T(STUCK, NULL),
+	[GESTURE_SIG_CHORD] = T(CHORD, NULL),
+      },
+    [GESTURE_REPEAT] =
+      {
+	[GESTURE_SIG_RELEASE_NOISE] = T(IDLE, ActionLong),
+	[GESTURE_SIG_RELEASE_SHORT] = T(IDLE, ActionLong),
+	[GESTURE_SIG_RELEASE_LONG] = T(IDLE, ActionLong),
+	[GESTURE_SIG_HOLD] = T(REPEAT, NULL),
+	[GESTURE_SIG_STUCK] = T(STUCK, NULL),
+      },
+    [GESTURE_STUCK] =
+      {
+	[GESTURE_SIG_RELEASE_NOISE] = T(IDLE, ActionStuckRelease),
+	[GESTURE_SIG_RELEASE_SHORT] = T(IDLE, ActionStuckRelease),
+	[GESTURE_SIG_RELEASE_LONG] = T(IDLE, ActionStuckRelease),
+      },
+    [GESTURE_GAP] =
+      {
+	[GESTURE_SIG_PRESS] = T(PRESSED, NULL),
+	[GESTURE_SIG_GAP] = T(IDLE, ActionGap),
+	[GESTURE_SIG_CHORD] = T(CHORD, NULL),
+      },
+    [GESTURE_CHORD] =
+      {
+	[GESTURE_SIG_RELEASE_NOISE] = T(IDLE, NULL),
+	[GESTURE_SIG_RELEASE_SHORT] = T(IDLE, NULL),
+	[GESTURE_SIG_RELEASE_LONG] = T(IDLE, NULL),
+	[GESTURE_SIG_RELEASE_STUCK] = T(IDLE, NULL),
+      },
+  };
+
+static const ehsm_def_t gesture_def = EHSM_DEF("gesture", states,
+					       transitions);
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void
+Arm (Gesture_t *gesture, ButtonTime_t deadline, GestureSignal_t signal)
+{
+  gesture->timer_armed = true;
+  gesture->deadline = deadline;
+  gesture->timer_signal = signal;
+}
+
+// Pending clicks are reported before anything that ends the sequence.
+static void
+FlushClicks (Gesture_t *gesture)
+{
+  static const EventType_t click_events[] =
+    { SHORT, DOUBLE, TRIPLE };
+
+  if (0 < gesture->clicks)
+    {
+      gesture->emit (gesture->ctx, click_events[gesture->clicks - 1],
+		     gesture->click_time);
+      gesture->clicks = 0;
+    }
+}
+
+static void
+EnterHeld (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  gesture->press_time = ev->time;
+}
+
+static void
+EnterPressed (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  Arm (gesture, ev->time + ev->th->long_time, GESTURE_SIG_HOLD);
+}
+
+static void
+EnterRepeat (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  FlushClicks (gesture);
+  gesture->emit (gesture->ctx, REPEAT, ev->time);
+
+  ButtonTime_t stuck_deadline = gesture->press_time + ev->th->stuck_time;
+  if ((ev->time + ev->th->repeat_time) < stuck_deadline)
+    {
+      Arm (gesture, ev->time + ev->th->repeat_time, GESTURE_SIG_HOLD);
+    }
+  else
+    {
+      Arm (gesture, stuck_deadline, GESTURE_SIG_STUCK);
+    }
+}
+
+static void
+EnterStuck (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  FlushClicks (gesture);
+  gesture->emit (gesture->ctx, STUCK, ev->time);
+}
+
+static void
+EnterGap (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  // Noise is too short to count, but it does not break a click sequence
+  // either: any release waits for the next click.
+  Arm (gesture, ev->time + ev->th->click_gap_time, GESTURE_SIG_GAP);
+}
+
+static void
+EnterChord (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  // Each member of a chord reports it, its own press is not classified.
+  gesture->clicks = 0;
+  gesture->emit (gesture->ctx, CHORD, ev->time);
+}
+
+static void
+ExitChord (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+
+  gesture->clicks = 0;
+}
+
+static void
+ExitTimed (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+
+  gesture->timer_armed = false;
+}
+
+static void
+ActionClick (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  // The click is reported from its release edge, not from the gap timeout
+  // that ends the sequence.
+  gesture->clicks++;
+  gesture->click_time = ev->time;
+  if (3 <= gesture->clicks)
+    {
+      FlushClicks (gesture);
+    }
+}
+
+static void
+ActionLong (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  FlushClicks (gesture);
+  gesture->emit (gesture->ctx, LONG, ev->time);
+}
+
+static void
+ActionStuckRelease (ehsm_t *hsm, const void *event)
+{
+  Gesture_t *gesture = hsm->ctx;
+  const GestureEvent_t *ev = event;
+
+  FlushClicks (gesture);
+  gesture->emit (gesture->ctx, NONE, ev->time);
+}
+
+static void
+ActionGap (ehsm_t *hsm, const void *event)
+{
+  FlushClicks (hsm->ctx);
+}
+
+/********************** external functions definition ************************/
+
+void
+GestureInit (Gesture_t *gesture, uint8_t id, void
+(*emit) (void *ctx, EventType_t event_type, ButtonTime_t time),
+	     void *ctx)
+{
+  gesture->clicks = 0;
+  gesture->press_time = 0;
+  gesture->click_time = 0;
+  gesture->timer_armed = false;
+  gesture->emit = emit;
+  gesture->ctx = ctx;
+  ehsm_init (&gesture->hsm, &gesture_def, id, GESTURE_IDLE, gesture,
+	     ehsm_trace_flight);
+}
+
+static void
+Dispatch (Gesture_t *gesture, const GestureThresholds_t *th,
+	  GestureSignal_t signal, ButtonTime_t time)
+{
+  GestureEvent_t event =
+    { th: th, time: time };
+
+  ehsm_dispatch (&gesture->hsm, signal, &event);
+}
+
+bool
+GestureIsPressed (const Gesture_t *gesture)
+{
+  return ehsm_is_in (&gesture->hsm, GESTURE_PRESSED);
+}
+
+void
+GestureThresholdsGet (GestureThresholds_t *th)
+{
+  uint32_t seq;
+
+  // Lock free: copy the published buffer, retry if another one was
+  // published meanwhile. The writer never touches the published buffer, so
+  // a reader never waits on a preempted writer.
+  do
+    {
+      seq = thresholds_seq;
+      __sync_synchronize ();
+      *th = thresholds[seq & 1];
+      __sync_synchronize ();
+    }
+  while (seq != thresholds_seq);
+}
+
+/**
+ * Takes the thresholds if 0 < short < long < stuck, 0 < repeat, and the
+ * click gap and the chord delay are both above 0 and below long: a gap or
+ * a chord window reaching long would hold back a LONG or a REPEAT.
+ */
+bool
+GestureThresholdsSet (const GestureThresholds_t *th)
+{
+  if ((0 == th->short_time) || (th->long_time <= th->short_time)
+      || (th->stuck_time <= th->long_time) || (0 == th->repeat_time)
+      || (0 == th->click_gap_time) || (th->long_time <= th->click_gap_time)
+      || (0 == th->chord_time) || (th->long_time <= th->chord_time))
+    {
+      return false;
+    }
+
+  // Writers are serialized, readers only see the buffer once published
+  eboard_osal_port_critical_enter ();
+  uint32_t seq = thresholds_seq;
+  thresholds[(seq + 1) & 1] = *th;
+  __sync_synchronize ();
+  thresholds_seq = seq + 1;
+  eboard_osal_port_critical_exit ();
+  return true;
+}
+
+void
+GestureDispatch (Gesture_t *gesture, GestureSignal_t signal,
+		 ButtonTime_t time)
+{
+  GestureThresholds_t th;
+  GestureThresholdsGet (&th);
+  Dispatch (gesture, &th, signal, time);
+}
+
+void
+GesturePress (Gesture_t *gesture, ButtonTime_t time)
+{
+  GestureDispatch (gesture, GESTURE_SIG_PRESS, time);
+}
+
+void
+GestureRelease (Gesture_t *gesture, ButtonTime_t time)
+{
+  ButtonTime_t duration = time - gesture->press_time;
+  GestureSignal_t signal;
+  GestureThresholds_t th;
+
+  GestureThresholdsGet (&th);
+
+  // Classify time
+  if (duration < th.short_time)
+    {
+      signal = GESTURE_SIG_RELEASE_NOISE;
+    }
+  else if (duration < th.long_time)
+    {
+      signal = GESTURE_SIG_RELEASE_SHORT;
+    }
+  else if (duration < th.stuck_time)
+    {
+      signal = GESTURE_SIG_RELEASE_LONG;
+    }
+  else
+    {
+      signal = GESTURE_SIG_RELEASE_STUCK;
+    }
+  Dispatch (gesture, &th, signal, time);
+}
+
+void
+GestureTimeout (Gesture_t *gesture, ButtonTime_t time)
+{
+  if (gesture->timer_armed)
+    {
+      GestureDispatch (gesture, gesture->timer_signal, time);
+    }
+}
+
+void
+GestureChord (Gesture_t *gesture, ButtonTime_t time)
+{
+  GestureDispatch (gesture, GESTURE_SIG_CHORD, time);
+}
+
+/********************** end of file ******************************************/
@@ -42,112 +42,425 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "driver.h"
+#include "econsole.h"
+#include "button.h"
 #include "task_button.h"
+#include "ao.h"
 #include "app.h"
 
 /********************** macros and definitions *******************************/
 
-#define TASK_DELAY 5
+#define EDGE_QUEUE_LEN 8 // Must be a power of two
+#define SAMPLE_QUEUE_LEN 2 // Sampled input blocks, must be a power of two
+
+// Raw edge recorder, one word per edge before any debouncing. Must be a
+// power of two, 0 removes it.
+#define RECORDER_LEN 256
+#define RECORD_TIME_MASK 0x0fffffffu // ms, wraps after 74 hours
+#define RECORD_IDX_SHIFT 28
+#define RECORD_LEVEL (1u << 31)
 
-#define pdTICKS_TO_MS( xTicks ) \
-    ( ( ( TickType_t ) ( xTicks ) * 1000u ) / configTICK_RATE_HZ )
 
 /********************** internal data declaration ****************************/
 
+typedef struct
+{
+  eboard_gpio_idx_t idx;
+  ButtonTime_t time;
+} ButtonEdge_t;
+
+typedef struct
+{
+  uint32_t samples[EBOARD_GPIO_SAMPLE_BLOCK];
+  ButtonTime_t time;
+} ButtonSamples_t;
+
 /********************** internal functions declaration ***********************/
 
+static void
+PublishEvent (eboard_gpio_idx_t idx, EventType_t event_type,
+	      ButtonTime_t time);
+
 /********************** internal data definition *****************************/
 
+// Every button handled by the service, one entry per input.
+static Button_t buttons[] =
+  {
+    { idx: EBOARD_GPIO_SW, on_event: PublishEvent }, };
+
+#define BUTTON_CNT (sizeof(buttons) / sizeof(buttons[0]))
+
+static ButtonService_t service;
+
+static TaskHandle_t button_task_handle = NULL;
+
+#ifndef EBOARD_CONFIG_INPUT_DMA
+// Edges captured by the EXTI interrupts for the task. All button lines share
+// one priority, so there is a single producer at a time.
+static ButtonEdge_t edge_queue[EDGE_QUEUE_LEN];
+static volatile uint32_t edge_queue_w = 0;
+static volatile uint32_t edge_queue_r = 0;
+
+// Debounce sampling rate, its statistics are printed by "per"
+static eboard_periodic_t sample_period;
+#else
+// Sample blocks from the DMA interrupts for the task, see
+// eboard_gpio_samples_enable() for the blocks that are handed over.
+static ButtonSamples_t sample_queue[SAMPLE_QUEUE_LEN];
+static volatile uint32_t sample_queue_w = 0;
+static volatile uint32_t sample_queue_r = 0;
+static uint32_t sample_levels; // Last sample of the interrupt, for the recorder
+#endif
+
+#if 0 < RECORDER_LEN
+static uint32_t recorder[RECORDER_LEN];
+static volatile uint32_t recorder_w = 0;
+static volatile bool recorder_on = true;
+#endif
+
 /********************** external data definition *****************************/
 
+// Events in flight, each one is shared by all of its subscribers. Enough for
+// a full led queue, the event the led is handling and the one being
+// published, so the led always gets the newest one.
+EPOOL_DEFINE(button_event_pool, ButtonEvent_t, LED_QUEUE_LEN + 2);
+
 /********************** internal functions definition ************************/
 
-static EventType_t
-TimeToEventType (ButtonTime_t time)
+static void
+PublishEvent (eboard_gpio_idx_t idx, EventType_t event_type,
+	      ButtonTime_t time)
+{
+  static uint32_t seq = 0;
+
+  // Counted even when the pool is exhausted, receivers see the gap.
+  seq++;
+
+  ButtonEvent_t *event = (ButtonEvent_t*) ao_event_new (&button_event_pool,
+							event_type);
+  if (NULL == event)
+    {
+      ELOG_TRACE("button: event pool exhausted");
+      return;
+    }
+
+  event->idx = idx;
+  event->time = time;
+  event->seq = seq;
+  ao_publish (&event->super);
+}
+
+#if 0 < RECORDER_LEN
+// From the edge and sample interrupts, which share one priority
+static void
+RecorderPut (eboard_gpio_idx_t idx, bool value, ButtonTime_t time)
+{
+  if (recorder_on)
+    {
+      recorder[recorder_w & (RECORDER_LEN - 1)] = ((uint32_t) time
+	  & RECORD_TIME_MASK) | ((uint32_t) idx << RECORD_IDX_SHIFT)
+	  | (value ? RECORD_LEVEL : 0);
+      recorder_w++;
+    }
+}
+#endif
+
+#ifndef EBOARD_CONFIG_INPUT_DMA
+static void
+ButtonEdgeCallback (eboard_gpio_idx_t idx, bool value, uint64_t time,
+		    void *arg)
 {
+  BaseType_t higher_priority_task_woken = pdFALSE;
+  uint32_t w = edge_queue_w;
 
-  EventType_t event_type;
-  // Classify time
-  if (time < SHORT_TIME)
+  // When full the edge is dropped, the level is sampled by the task anyway.
+  if ((w - edge_queue_r) < EDGE_QUEUE_LEN)
     {
-      event_type = NONE;
+      edge_queue[w & (EDGE_QUEUE_LEN - 1)].idx = idx;
+      edge_queue[w & (EDGE_QUEUE_LEN - 1)].time = time;
+      __sync_synchronize ();
+      edge_queue_w = w + 1;
     }
-  else if (time < LONG_TIME)
+
+#if 0 < RECORDER_LEN
+  RecorderPut (idx, value, time);
+#endif
+
+  vTaskNotifyGiveFromISR(button_task_handle, &higher_priority_task_woken);
+  portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+#else
+static void
+ButtonSamplesCallback (const uint32_t *samples, size_t count, uint64_t time,
+		       void *arg)
+{
+  BaseType_t higher_priority_task_woken = pdFALSE;
+  uint32_t w = sample_queue_w;
+
+  // When full the block is dropped: the debouncer then misses its samples
+  // but still sees the levels of the next one.
+  if ((w - sample_queue_r) < SAMPLE_QUEUE_LEN)
     {
-      event_type = SHORT;
+      ButtonSamples_t *block = &sample_queue[w & (SAMPLE_QUEUE_LEN - 1)];
+      memcpy (block->samples, samples, count * sizeof(samples[0]));
+      block->time = time;
+      __sync_synchronize ();
+      sample_queue_w = w + 1;
     }
-  else if (time < STUCK_TIME)
+
+#if 0 < RECORDER_LEN
+  for (size_t i = 0; i < count; i++)
     {
-      event_type = LONG;
+      uint32_t changed = samples[i] ^ sample_levels;
+      for (uint32_t mask = changed; 0 != mask; mask &= (mask - 1))
+	{
+	  uint32_t idx = __builtin_ctz (mask);
+	  RecorderPut (idx, 0 != (samples[i] & (1u << idx)),
+		       time - ((count - 1 - i) * EBOARD_GPIO_SAMPLE_PERIOD_MS));
+	}
+      sample_levels = samples[i];
+    }
+#else
+  sample_levels = samples[count - 1];
+#endif
+
+  vTaskNotifyGiveFromISR(button_task_handle, &higher_priority_task_woken);
+  portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+#endif
+
+#if 0 < RECORDER_LEN
+// One line per edge, oldest first: time (ms), delta to the previous edge,
+// input and level. Recording pauses while dumping.
+static void
+RecorderDump (void)
+{
+  bool was_on = recorder_on;
+  recorder_on = false;
+  __sync_synchronize ();
+
+  uint32_t w = recorder_w;
+  uint32_t count = (w < RECORDER_LEN) ? w : RECORDER_LEN;
+  uint32_t prev = 0;
+
+  econsole_printf ("rec: %lu edges, %lu lost\r\n", count, w - count);
+  for (uint32_t i = w - count; i != w; i++)
+    {
+      uint32_t entry = recorder[i & (RECORDER_LEN - 1)];
+      uint32_t time = entry & RECORD_TIME_MASK;
+      econsole_printf ("%lu %lu %lu %u\r\n", time,
+		       (i == (w - count)) ? 0 : ((time - prev) & RECORD_TIME_MASK),
+		       (entry >> RECORD_IDX_SHIFT) & 0x7u,
+		       (entry & RECORD_LEVEL) ? 1 : 0);
+      prev = time;
+    }
+
+  recorder_on = was_on;
+}
+#endif
+
+/********************** external functions definition ************************/
+
+void
+ButtonThresholdsCommand (int argc, char *argv[])
+{
+  GestureThresholds_t th;
+  GestureThresholdsGet (&th);
+
+  if (3 <= argc)
+    {
+      static const struct
+      {
+	const char *name;
+	size_t offset;
+      } fields[] =
+	{
+	  { "short", offsetof(GestureThresholds_t, short_time) },
+	  { "long", offsetof(GestureThresholds_t, long_time) },
+	  { "stuck", offsetof(GestureThresholds_t, stuck_time) },
+	  { "gap", offsetof(GestureThresholds_t, click_gap_time) },
+	  { "repeat", offsetof(GestureThresholds_t, repeat_time) },
+	  { "chord", offsetof(GestureThresholds_t, chord_time) }, };
+      size_t i = 0;
+      while ((i < (sizeof(fields) / sizeof(fields[0])))
+	  && (0 != strcmp (argv[1], fields[i].name)))
+	{
+	  i++;
+	}
+      char *end;
+      unsigned long value = strtoul (argv[2], &end, 10);
+      if ((sizeof(fields) / sizeof(fields[0])) <= i)
+	{
+	  econsole_printf ("thr: unknown threshold %s\r\n", argv[1]);
+	  return;
+	}
+      if (('\0' == argv[2][0]) || ('\0' != *end))
+	{
+	  econsole_printf ("thr: bad value %s\r\n", argv[2]);
+	  return;
+	}
+      *(uint32_t*) ((uint8_t*) &th + fields[i].offset) = (uint32_t) value;
+      if (!GestureThresholdsSet (&th))
+	{
+	  econsole_printf ("thr: rejected, needs 0 < short < long < stuck, "
+			   "0 < repeat, 0 < gap < long, 0 < chord < long\r\n");
+	  GestureThresholdsGet (&th);
+	}
+    }
+
+  econsole_printf (
+      "thr: short %lu long %lu stuck %lu gap %lu repeat %lu chord %lu\r\n",
+      th.short_time, th.long_time, th.stuck_time, th.click_gap_time,
+      th.repeat_time, th.chord_time);
+}
+
+void
+ButtonRecorderCommand (int argc, char *argv[])
+{
+#if 0 < RECORDER_LEN
+  if (argc < 2)
+    {
+      econsole_printf ("rec: %s, %lu edges\r\n", recorder_on ? "on" : "off",
+		       recorder_w);
+    }
+  else if (0 == strcmp (argv[1], "on"))
+    {
+      recorder_on = true;
+    }
+  else if (0 == strcmp (argv[1], "off"))
+    {
+      recorder_on = false;
+    }
+  else if (0 == strcmp (argv[1], "clear"))
+    {
+      // The edge interrupts are masked, no write is in flight
+      eboard_osal_port_critical_enter ();
+      recorder_w = 0;
+      eboard_osal_port_critical_exit ();
+    }
+  else if (0 == strcmp (argv[1], "dump"))
+    {
+      RecorderDump ();
     }
   else
     {
-      event_type = STUCK;
+      econsole_printf ("rec: unknown option %s\r\n", argv[1]);
     }
-  return event_type;
+#else
+  econsole_printf ("rec: not built, see RECORDER_LEN\r\n");
+#endif
 }
 
+/**
+ * Button service: a single task for every input in buttons[].
+ *
+ * Events are only emitted on classification transitions, as decided by the
+ * gesture recognizer (see gesture.c): clicks (SHORT/DOUBLE/TRIPLE), a long
+ * press on release (LONG), hold auto-repeat (REPEAT), the stuck condition
+ * entered (STUCK) and left (NONE), and chords across buttons (CHORD).
+ *
+ * Edges only wake the task: the inputs are then sampled at a fixed
+ * DEBOUNCE_PERIOD rate (absolute release times, see eboard_periodic_t)
+ * through the debouncer until they settle, and an accepted
+ * change is dated with the first edge of its burst. Pending thresholds live
+ * in a deadline queue sorted by time, the task sleeps until the earliest one
+ * so its cost follows the events, not the number of buttons. Those decisions
+ * are made in button.c, which the host replay harness runs as well; this
+ * task only feeds it edges, samples and the time.
+ *
+ * With EBOARD_CONFIG_INPUT_DMA the 1 kHz sample blocks are fed instead: a
+ * block with a change wakes the task, and it takes every block while the
+ * debouncer is counting.
+ */
 void
 task_ButtonEvent (void *pvParameters)
 {
-  ButtonTime_t last_time_event = 0;
-  ButtonTime_t delta_time = 0;
-  bool restart_timer_flag = true;
+  ButtonTime_t now = eboard_time_ms ();
+  ButtonTime_t deadline;
+  uint32_t levels = eboard_gpio_read_inputs ();
 
-  while (true)
+  button_task_handle = xTaskGetCurrentTaskHandle ();
+  ButtonServiceInit (&service, buttons, BUTTON_CNT, levels, now);
+#ifndef EBOARD_CONFIG_INPUT_DMA
+  eboard_periodic_init (&sample_period, pdMS_TO_TICKS(DEBOUNCE_PERIOD));
+  eboard_periodic_register (&sample_period, "button");
+  for (size_t i = 0; i < BUTTON_CNT; i++)
     {
-      // INFO: As we always send events (For released and pressed) we always
-      // allocate memory here.
-      EventType_t *event = (EventType_t*) pvPortMalloc (sizeof(EventType_t));
-
-      // Check the memory is correctly allocated.
-      assert(event != NULL);
+      eboard_gpio_irq_register (buttons[i].idx, ButtonEdgeCallback, NULL);
+    }
+#else
+  sample_levels = levels;
+  eboard_gpio_samples_register (ButtonSamplesCallback, NULL);
+#endif
 
-      if (eboard_switch ()) // Button pressed
+  while (true)
+    {
+      // Sleep until the next edge or sample block, the next debounce sample
+      // or the earliest deadline.
+      TickType_t timeout = portMAX_DELAY;
+      now = eboard_time_ms ();
+      if (ButtonServiceDeadline (&service, &deadline))
 	{
-
-	  if (restart_timer_flag)
+	  timeout = (now < deadline) ? pdMS_TO_TICKS(deadline - now) : 0;
+	}
+#ifndef EBOARD_CONFIG_INPUT_DMA
+      if (ButtonServiceIsSampling (&service))
+	{
+	  TickType_t sample_timeout = eboard_periodic_timeout (&sample_period);
+	  if (sample_timeout < timeout)
 	    {
-	      last_time_event = pdTICKS_TO_MS(eboard_osal_port_get_time ());
-	      restart_timer_flag = false;
+	      timeout = sample_timeout;
 	    }
+	}
+#endif
+      ulTaskNotifyTake (pdTRUE, timeout);
+      now = eboard_time_ms ();
 
-	  delta_time = pdTICKS_TO_MS(eboard_osal_port_get_time ())
-	      - last_time_event;
+#ifndef EBOARD_CONFIG_INPUT_DMA
+      while (edge_queue_r != edge_queue_w)
+	{
+	  ButtonEdge_t edge = edge_queue[edge_queue_r & (EDGE_QUEUE_LEN - 1)];
+	  __sync_synchronize ();
+	  edge_queue_r++;
 
-	  if (delta_time > STUCK_TIME)
-	    {
-	      *event = STUCK;
-	    }
-	  else
+	  if (ButtonServiceEdge (&service, edge.idx, edge.time))
 	    {
-	      *event = NONE;
+	      // First sample right away, then every DEBOUNCE_PERIOD
+	      eboard_periodic_start (&sample_period);
 	    }
 	}
-      else // Button not pressed
-	{
-	  EventType_t event_type = TimeToEventType (delta_time);
 
-	  if (delta_time > STUCK_TIME)
+      if (ButtonServiceIsSampling (&service)
+	  && eboard_periodic_due (&sample_period))
+	{
+	  if (0 < eboard_periodic_release (&sample_period))
 	    {
-	      event_type = NONE;
+	      ELOG("button: debounce sampling overrun, %lu missed",
+		   sample_period.overruns);
 	    }
-
-	  // Push event to the queue
-	  *event = event_type;
-
-	  restart_timer_flag = true;
+	  ButtonServiceSample (&service, eboard_gpio_read_inputs (), now);
 	}
-
-      BaseType_t ret = push_led_event (event);
-
-      if (ret != pdTRUE)
+#else
+      // The DMA samples are the edges and the debounce samples at once,
+      // the inputs are never read through the HAL here.
+      while (sample_queue_r != sample_queue_w)
 	{
-	  vPortFree (event);
+	  ButtonSamples_t *block = &sample_queue[sample_queue_r
+	      & (SAMPLE_QUEUE_LEN - 1)];
+	  ButtonServiceSamples (&service, block->samples,
+				EBOARD_GPIO_SAMPLE_BLOCK, block->time);
+	  __sync_synchronize ();
+	  sample_queue_r++;
 	}
+      eboard_gpio_samples_enable (ButtonServiceIsSampling (&service));
+#endif
 
-      eboard_osal_port_delay (TASK_DELAY);
+      ButtonServiceTimeout (&service, now);
     }
 }
 
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : task_console.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driver.h"
+#include "econsole.h"
+#include "ao.h"
+#include "task_button.h"
+#include "task_console.h"
+#include "task_led.h"
+#include "app.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static void
+PeriodicCommand (int argc, char *argv[]);
+static void
+ConsoleRxCallback (void *arg);
+
+/********************** internal data definition *****************************/
+
+// Console commands, "help" is built in.
+static const econsole_cmd_t console_commands[] =
+  {
+    { name: "thr", help: "thr [short|long|stuck|gap|repeat|chord ms], "
+	"button thresholds", handler: ButtonThresholdsCommand },
+    { name: "heap", help: "heap, event pool blocks in use", handler:
+	HeapCommand },
+    { name: "rec", help: "rec [on|off|clear|dump], raw button edges",
+	handler: ButtonRecorderCommand },
+    { name: "ao", help: "ao, active object queues", handler: AoCommand },
+    { name: "lat", help: "lat [clear], button edge to led latency", handler:
+	LedLatencyCommand },
+    { name: "per", help: "per, periodic release jitter and overruns",
+	handler: PeriodicCommand },
+    { name: "stack", help: "stack, used stack of every task", handler:
+	StackCommand }, };
+
+// UART poll rate, its statistics are printed by "per"
+static TaskHandle_t console_task_handle = NULL;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+// One line per registered eboard_periodic_t, times in ticks. hist[0] counts
+// early releases, hist[n] the ones n - 1 ticks late.
+static void
+PeriodicCommand (int argc, char *argv[])
+{
+  eboard_periodic_t stats;
+  const char *name;
+
+  for (uint32_t i = 0; NULL != (name = eboard_periodic_stats (i, &stats));
+      i++)
+    {
+      econsole_printf (
+	  "%s: period %lu, %lu releases, %lu overruns, min %lu, max %lu\r\n",
+	  name, stats.period, stats.releases, stats.overruns,
+	  (0 < stats.max) ? stats.min : 0, stats.max);
+      econsole_printf ("%s: hist", name);
+      for (uint32_t bin = 0; bin < EBOARD_PERIODIC_HIST_BINS; bin++)
+	{
+	  econsole_printf (" %lu", stats.hist[bin]);
+	}
+      econsole_printf ("\r\n");
+    }
+}
+
+static void
+ConsoleRxCallback (void *arg)
+{
+  BaseType_t higher_priority_task_woken = pdFALSE;
+
+  vTaskNotifyGiveFromISR(console_task_handle, &higher_priority_task_woken);
+  portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+/********************** external functions definition ************************/
+
+void
+task_Console (void *pvParameters)
+{
+  econsole_init (console_commands,
+		 sizeof(console_commands) / sizeof(console_commands[0]));
+  console_task_handle = xTaskGetCurrentTaskHandle ();
+  eboard_uart_rx_register (ConsoleRxCallback, NULL);
+
+  // Asleep until the UART receives, then every complete line is run. Bytes
+  // arriving while it runs leave a notification pending.
+  while (true)
+    {
+      ulTaskNotifyTake (pdTRUE, portMAX_DELAY);
+      econsole_poll ();
+    }
+}
+
+/********************** end of file ******************************************/
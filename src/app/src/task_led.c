@@ -41,62 +41,318 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "driver.h"
+#include "econsole.h"
+#include "ehsm.h"
 #include "task_led.h"
 
 /********************** macros and definitions *******************************/
 
+#define LATENCY_BINS 64 // The last bin takes every longer latency
+
+// The edge path is debounce, about 15 to 20 ms, plus up to one sample block
+// with EBOARD_CONFIG_INPUT_DMA. A click waits CLICK_GAP_TIME for the next one
+// before it is reported.
+#define LATENCY_EDGE_BIN_US    1000 // 0 to 64 ms
+#define LATENCY_GESTURE_BIN_US 8000 // 0 to 512 ms
+
+typedef struct
+{
+  bool green;
+  bool red;
+} LedState_t;
+
+// Source edge to led output, in us
+typedef struct
+{
+  const char *name;
+  uint32_t bin_us;
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint32_t last_seq;
+  uint32_t bins[LATENCY_BINS];
+} LedLatency_t;
+
+typedef enum
+{
+  LATENCY_EDGE,    // Reported as soon as its edge or timeout is seen
+  LATENCY_GESTURE, // Click events, held back for the click gap by design
+  LATENCY__CNT,
+} LatencyKind_t;
+
+typedef enum
+{
+  LED_ACTIVE, // Parent of the others, takes every button event
+  LED_OFF,
+  LED_GREEN,
+  LED_RED,
+  LED_BOTH,
+  LED__CNT,
+} LedMode_t;
+
 /********************** internal data declaration ****************************/
 
 /********************** internal functions declaration ***********************/
 
+static void
+LedDispatch (ao_t *ao, const ao_event_t *event);
+static void
+EnterOff (ehsm_t *hsm, const void *event);
+static void
+EnterGreen (ehsm_t *hsm, const void *event);
+static void
+EnterRed (ehsm_t *hsm, const void *event);
+static void
+EnterBoth (ehsm_t *hsm, const void *event);
+static void
+LatencyClear (LedLatency_t *latency);
+static void
+LatencyRecord (LedLatency_t *latency, uint32_t value, uint32_t seq);
+static uint32_t
+LatencyPercentile (const LedLatency_t *latency, uint32_t percent);
+static void
+LatencyPrint (const LedLatency_t *latency);
+
 /********************** internal data definition *****************************/
 
+static LedState_t led_output; // What the pins show
+static LedState_t led_next;   // Folded from the events of the current batch
+
+// Newest button event of the batch, the one the output will show
+static ButtonTime_t led_cause_time;
+static uint32_t led_cause_seq;
+static LatencyKind_t led_cause_kind;
+
+// Written by the led task, read by the console under a critical section
+static LedLatency_t led_latency[LATENCY__CNT] =
+  {
+    [LATENCY_EDGE] =
+      { name: "edge", bin_us: LATENCY_EDGE_BIN_US, min: UINT32_MAX },
+    [LATENCY_GESTURE] =
+      { name: "gesture", bin_us: LATENCY_GESTURE_BIN_US, min: UINT32_MAX }, };
+
+// Each mode sets led_next on entry, the pins follow on AO_SIG_FLUSH.
+static const ehsm_state_t led_states[LED__CNT] =
+  {
+    [LED_ACTIVE] = EHSM_STATE(ACTIVE, EHSM_NONE, NULL, NULL),
+    [LED_OFF] = EHSM_STATE(OFF, LED_ACTIVE, EnterOff, NULL),
+    [LED_GREEN] = EHSM_STATE(GREEN, LED_ACTIVE, EnterGreen, NULL),
+    [LED_RED] = EHSM_STATE(RED, LED_ACTIVE, EnterRed, NULL),
+    [LED_BOTH] = EHSM_STATE(BOTH, LED_ACTIVE, EnterBoth, NULL), };
+
+// Signals are the button EventType_t. Multi-clicks are short presses too,
+// a hold shows red from its first auto-repeat on and a chord shows both.
+static const ehsm_transition_t led_transitions[LED__CNT][EVENT_TYPE__CNT] =
+  {
+    [LED_ACTIVE] =
+      {
+	[NONE] = EHSM_TRAN(LED_OFF, NULL),
+	[SHORT] = EHSM_TRAN(LED_GREEN, NULL),
+	[DOUBLE] = EHSM_TRAN(LED_GREEN, NULL),
+	[TRIPLE] = EHSM_TRAN(LED_GREEN, NULL),
+	[LONG] = EHSM_TRAN(LED_RED, NULL),
+	[REPEAT] = EHSM_TRAN(LED_RED, NULL),
+	[STUCK] = EHSM_TRAN(LED_BOTH, NULL),
+	[CHORD] = EHSM_TRAN(LED_BOTH, NULL),
+      },
+  };
+
+static const ehsm_def_t led_def = EHSM_DEF("led", led_states,
+					   led_transitions);
+
+static ehsm_t led_hsm;
+
 /********************** external data definition *****************************/
 
+// Every event of a wake-up is folded into led_next, the pins are written
+// once at the end of the batch, see AO_SIG_FLUSH. When the queue is full the
+// oldest event goes, the newest state is never lost.
+AO_DEFINE_LATEST(ao_LedEvent, LedDispatch, tskIDLE_PRIORITY, LED_QUEUE_LEN,
+		 128);
+
 /********************** internal functions definition ************************/
 
-void
-task_LedEvent (void *arguments)
+static void
+EnterOff (ehsm_t *hsm, const void *event)
 {
-  // The system shall init with all leds off.
-  eboard_led_red (false);
-  eboard_led_green (false);
-  eboard_led_blue (false);
+  led_next.green = false;
+  led_next.red = false;
+}
+
+static void
+EnterGreen (ehsm_t *hsm, const void *event)
+{
+  led_next.green = true;
+  led_next.red = false;
+}
+
+static void
+EnterRed (ehsm_t *hsm, const void *event)
+{
+  led_next.green = false;
+  led_next.red = true;
+}
+
+static void
+EnterBoth (ehsm_t *hsm, const void *event)
+{
+  led_next.green = true;
+  led_next.red = true;
+}
 
-  while (true)
+// Called under a critical section
+static void
+LatencyClear (LedLatency_t *latency)
+{
+  latency->count = 0;
+  latency->min = UINT32_MAX;
+  latency->max = 0;
+  latency->last_seq = 0;
+  memset (latency->bins, 0, sizeof(latency->bins));
+}
+
+static void
+LatencyRecord (LedLatency_t *latency, uint32_t value, uint32_t seq)
+{
+  uint32_t bin = value / latency->bin_us;
+
+  taskENTER_CRITICAL();
+  latency->count++;
+  if (value < latency->min)
     {
-      EventType_t *event = pop_led_event ();
+      latency->min = value;
+    }
+  if (latency->max < value)
+    {
+      latency->max = value;
+    }
+  latency->last_seq = seq;
+  latency->bins[(bin < LATENCY_BINS) ? bin : (LATENCY_BINS - 1)]++;
+  taskEXIT_CRITICAL();
+}
 
-      // Check if a valid pointer was returned.
-      assert(event != NULL);
+// Upper edge of the bin holding the given percentile, bounded by max
+static uint32_t
+LatencyPercentile (const LedLatency_t *latency, uint32_t percent)
+{
+  uint32_t rank = ((latency->count * percent) + 99) / 100;
+  uint32_t seen = 0;
 
-      switch (*event)
+  for (uint32_t bin = 0; bin < LATENCY_BINS; bin++)
+    {
+      seen += latency->bins[bin];
+      if (rank <= seen)
+	{
+	  uint32_t edge = (bin + 1) * latency->bin_us;
+	  return (edge < latency->max) ? edge : latency->max;
+	}
+    }
+  return latency->max;
+}
+
+static void
+LedDispatch (ao_t *ao, const ao_event_t *event)
+{
+  switch (event->sig)
+    {
+    case AO_SIG_START:
+      // The system shall init with all leds off.
+      eboard_led_red (false);
+      eboard_led_green (false);
+      eboard_led_blue (false);
+      led_output.green = false;
+      led_output.red = false;
+      ehsm_init (&led_hsm, &led_def, HSM_ID_LED, LED_OFF, NULL,
+		 ehsm_trace_flight);
+      break;
+    case AO_SIG_FLUSH:
+      if ((led_next.green == led_output.green)
+	  && (led_next.red == led_output.red))
 	{
-	case NONE:
-	  eboard_led_green (false);
-	  eboard_led_red (false);
-	  break;
-	case SHORT:
-	  eboard_led_green (true);
-	  eboard_led_red (false);
-	  break;
-	case LONG:
-	  eboard_led_green (false);
-	  eboard_led_red (true);
-	  break;
-	case STUCK:
-	  eboard_led_green (true);
-	  eboard_led_red (true);
-	  break;
-	default:
 	  break;
 	}
-      // After the event is processed, deallocate its memory.
-      vPortFree (event);
+
+      // Only the pins that changed over the batch are written.
+      if (led_next.green != led_output.green)
+	{
+	  eboard_led_green (led_next.green);
+	}
+      if (led_next.red != led_output.red)
+	{
+	  eboard_led_red (led_next.red);
+	}
+      led_output = led_next;
+
+      LatencyRecord (&led_latency[led_cause_kind],
+		     (uint32_t) (eboard_time_us () - (led_cause_time * 1000u)),
+		     led_cause_seq);
+#ifdef APP_CONFIG_LATENCY_GPIO
+      static bool debug_level = false;
+      debug_level = !debug_level;
+      eboard_led_blue (debug_level);
+#endif
+      break;
+    default:
+      if (ehsm_dispatch (&led_hsm, event->sig, event))
+	{
+	  const ButtonEvent_t *button_event = (const ButtonEvent_t*) event;
+	  led_cause_time = button_event->time;
+	  led_cause_seq = button_event->seq;
+	  led_cause_kind =
+	      ((SHORT == event->sig) || (DOUBLE == event->sig)
+		  || (TRIPLE == event->sig)) ? LATENCY_GESTURE : LATENCY_EDGE;
+	}
+      break;
+    }
+}
+
+static void
+LatencyPrint (const LedLatency_t *latency)
+{
+  if (0 == latency->count)
+    {
+      econsole_printf ("lat %s: no samples\r\n", latency->name);
+      return;
     }
+  econsole_printf ("lat %s: %lu samples, last seq %lu, "
+		   "source to led in us\r\n", latency->name, latency->count,
+		   latency->last_seq);
+  econsole_printf ("lat %s: min %lu, p50 %lu, p90 %lu, p99 %lu, max %lu\r\n",
+		   latency->name, latency->min,
+		   LatencyPercentile (latency, 50),
+		   LatencyPercentile (latency, 90),
+		   LatencyPercentile (latency, 99), latency->max);
+}
+
+/********************** external functions definition ************************/
 
+void
+LedLatencyCommand (int argc, char *argv[])
+{
+  LedLatency_t latency[LATENCY__CNT];
+
+  if ((2 == argc) && (0 == strcmp (argv[1], "clear")))
+    {
+      taskENTER_CRITICAL();
+      for (uint32_t kind = 0; kind < LATENCY__CNT; kind++)
+	{
+	  LatencyClear (&led_latency[kind]);
+	}
+      taskEXIT_CRITICAL();
+      return;
+    }
+
+  taskENTER_CRITICAL();
+  memcpy (latency, led_latency, sizeof(latency));
+  taskEXIT_CRITICAL();
+
+  for (uint32_t kind = 0; kind < LATENCY__CNT; kind++)
+    {
+      LatencyPrint (&latency[kind]);
+    }
 }
 
 /********************** end of file ******************************************/
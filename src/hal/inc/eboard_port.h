@@ -43,6 +43,9 @@
 
 /********************** macros and definitions *******************************/
 
+// TIM8 updates every EBOARD_GPIO_SAMPLE_PERIOD_MS, see MX_TIM8_Init()
+#define INPUT_DMA_BLOCK EBOARD_GPIO_SAMPLE_BLOCK // Samples per half buffer, must be even
+
 /********************** internal data declaration ****************************/
 
 typedef struct
@@ -65,10 +68,79 @@ static driver_gpio_descriptor_t_ driver_gpios_[] = { {idx: EBOARD_GPIO_LEDR, GPI
 extern UART_HandleTypeDef huart3;
 UART_HandleTypeDef *p_huart_selected_ = &huart3;
 
+// Linker script symbols, only their addresses are used
+extern const char _etext[];
+extern const char _sidata[];
+extern const char _edata[];
+extern const char _ebss[];
+
+// Tick count extended to 64 bits, read at least once per half wrap (24
+// days at 1 kHz): the log flush from the idle hook does it.
+static eboard_time_ext_t time_ext_;
+
+#ifdef EBOARD_CONFIG_INPUT_DMA
+extern TIM_HandleTypeDef htim8;
+
+// GPIOC IDR snapshots, the DMA fills one half while the other is scanned
+static uint16_t input_dma_buffer_[2 * INPUT_DMA_BLOCK] __attribute__((aligned(4)));
+static uint16_t input_dma_mask_;
+static uint16_t input_dma_last_;
+static uint32_t input_dma_samples_[INPUT_DMA_BLOCK];
+#endif
+
 /********************** external data definition *****************************/
 
 /********************** internal functions definition ************************/
 
+#ifdef EBOARD_CONFIG_INPUT_DMA
+static void input_dma_scan_(const uint16_t* block)
+{
+  uint64_t time = eboard_time_ms();
+  const uint32_t* pairs = (const uint32_t*)block;
+  uint32_t prev = input_dma_last_;
+  uint32_t changed = 0;
+
+  // Two samples per word, each one XOR its predecessor. Usually nothing
+  // changed and this is all the work done for the block.
+  for(size_t i = 0; i < (INPUT_DMA_BLOCK / 2); ++i)
+  {
+    uint32_t pair = pairs[i];
+    changed |= pair ^ ((pair << 16) | prev);
+    prev = pair >> 16;
+  }
+  changed = (changed | (changed >> 16)) & input_dma_mask_;
+
+  if(eboard_hal_port_gpio_samples_wanted(0 != changed))
+  {
+    // IDR bits to input levels, the last sample is taken about now
+    for(size_t i = 0; i < INPUT_DMA_BLOCK; ++i)
+    {
+      uint32_t levels = 0;
+      for(size_t k = 0; k < (sizeof(driver_gpios_) / sizeof(driver_gpios_[0])); ++k)
+      {
+        if((GPIOC == driver_gpios_[k].GPIOx) && (block[i] & driver_gpios_[k].GPIO_Pin))
+        {
+          levels |= (1u << driver_gpios_[k].idx);
+        }
+      }
+      input_dma_samples_[i] = levels;
+    }
+    eboard_hal_port_gpio_samples(input_dma_samples_, INPUT_DMA_BLOCK, time);
+  }
+  input_dma_last_ = (uint16_t)prev;
+}
+
+static void input_dma_half_cplt_(DMA_HandleTypeDef* hdma)
+{
+  input_dma_scan_(input_dma_buffer_);
+}
+
+static void input_dma_cplt_(DMA_HandleTypeDef* hdma)
+{
+  input_dma_scan_(input_dma_buffer_ + INPUT_DMA_BLOCK);
+}
+#endif
+
 /********************** external functions definition ************************/
 
 void euart_hal_receive(void *phardware_handle, uint8_t *pbuffer, size_t size)
@@ -83,6 +155,7 @@ void euart_hal_send(void *phardware_handle, uint8_t *pbuffer, size_t size)
 
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
+  ELOG_ISR("uart error: 0x%lx", huart->ErrorCode);
   eboard_hal_port_uart_error((void*)huart);
   // TODO: ¿?
 }
@@ -97,6 +170,60 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
   eboard_hal_port_uart_tx_irq((void*)huart);
 }
 
+bool eboard_hal_port_is_rom(const void *ptr)
+{
+  return (FLASH_BASE <= (uintptr_t)ptr) && ((uintptr_t)ptr <= FLASH_END);
+}
+
+void eboard_hal_port_image_layout(uint32_t layout[EBOARD_IMAGE_LAYOUT_WORDS])
+{
+  layout[0] = (uint32_t)(uintptr_t)_etext;
+  layout[1] = (uint32_t)(uintptr_t)_sidata;
+  layout[2] = (uint32_t)(uintptr_t)_edata;
+  layout[3] = (uint32_t)(uintptr_t)_ebss;
+}
+
+#ifndef EBOARD_CONFIG_INPUT_DMA
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  // EXTI lines are shared by pin number across ports
+  for(size_t i = 0; i < (sizeof(driver_gpios_) / sizeof(driver_gpios_[0])); ++i)
+  {
+    if(GPIO_Pin == driver_gpios_[i].GPIO_Pin)
+    {
+      eboard_hal_port_gpio_irq((void*)(driver_gpios_ + i));
+    }
+  }
+}
+#else
+void eboard_hal_port_gpio_sampling_start(void)
+{
+  input_dma_mask_ = 0;
+  for(size_t i = 0; i < (sizeof(driver_gpios_) / sizeof(driver_gpios_[0])); ++i)
+  {
+    if(GPIOC == driver_gpios_[i].GPIOx)
+    {
+      input_dma_mask_ |= driver_gpios_[i].GPIO_Pin;
+    }
+  }
+  input_dma_last_ = (uint16_t)GPIOC->IDR;
+
+  // CubeMX still sets the sampled pins up as EXTI rising/falling inputs:
+  // mask their lines and drop any pending request, the DMA takes over.
+  EXTI->IMR &= ~(uint32_t)input_dma_mask_;
+  EXTI->PR = input_dma_mask_;
+
+  // Each TIM8 update requests one IDR read from DMA2, the CPU only sees the
+  // half and full transfer interrupts.
+  DMA_HandleTypeDef* hdma = htim8.hdma[TIM_DMA_ID_UPDATE];
+  hdma->XferHalfCpltCallback = input_dma_half_cplt_;
+  hdma->XferCpltCallback = input_dma_cplt_;
+  HAL_DMA_Start_IT(hdma, (uint32_t)&GPIOC->IDR, (uint32_t)input_dma_buffer_, 2 * INPUT_DMA_BLOCK);
+  __HAL_TIM_ENABLE_DMA(&htim8, TIM_DMA_UPDATE);
+  HAL_TIM_Base_Start(&htim8);
+}
+#endif
+
 void eboard_hal_port_gpio_write(void *handle, bool value)
 {
   driver_gpio_descriptor_t_ *hgpio = (driver_gpio_descriptor_t_*)handle;
@@ -115,9 +242,67 @@ uint32_t eboard_osal_port_get_time(void)
   return (uint32_t)xTaskGetTickCount();
 }
 
+uint64_t eboard_osal_port_get_time_ms(void)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  uint64_t ticks = eboard_time_ext_ticks(&time_ext_, (uint32_t)xTaskGetTickCountFromISR());
+  eboard_osal_port_isr_unlock(state);
+  // configTICK_RATE_HZ divides 1000, no 64 bit division
+  return ticks * (1000u / configTICK_RATE_HZ);
+}
+
+uint64_t eboard_osal_port_get_time_us(void)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  uint32_t ticks = (uint32_t)xTaskGetTickCountFromISR();
+  uint32_t load = SysTick->LOAD + 1;
+  uint32_t elapsed = load - SysTick->VAL;
+  if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+  {
+    // SysTick wrapped but its interrupt is masked: count that tick here
+    ticks++;
+    elapsed = load - SysTick->VAL;
+  }
+  if(1 == load)
+  {
+    // Scheduler not started, no sub tick resolution
+    elapsed = 0;
+  }
+  uint64_t us = eboard_time_ext_us(&time_ext_, ticks, elapsed, load, 1000000u / configTICK_RATE_HZ);
+  eboard_osal_port_isr_unlock(state);
+  return us;
+}
+
 void eboard_osal_port_delay(uint32_t time_ms)
 {
   vTaskDelay((TickType_t)((time_ms) / portTICK_PERIOD_MS));
 }
 
+void eboard_osal_port_delay_until(uint32_t* pwake_time, uint32_t period)
+{
+  vTaskDelayUntil((TickType_t*)pwake_time, (TickType_t)period);
+}
+
+void eboard_osal_port_critical_enter(void)
+{
+  taskENTER_CRITICAL();
+}
+
+void eboard_osal_port_critical_exit(void)
+{
+  taskEXIT_CRITICAL();
+}
+
+uint32_t eboard_osal_port_isr_lock(void)
+{
+  // Masks every interrupt allowed to call the kernel, safe from both task
+  // and interrupt context.
+  return (uint32_t)taskENTER_CRITICAL_FROM_ISR();
+}
+
+void eboard_osal_port_isr_unlock(uint32_t state)
+{
+  taskEXIT_CRITICAL_FROM_ISR((UBaseType_t)state);
+}
+
 /********************** end of file ******************************************/
@@ -50,22 +50,69 @@ extern "C" {
 #include <stdbool.h>
 #include <string.h>
 
+#include "eformat.h"
+
 /********************** macros ***********************************************/
 
 #define ELOG_MAXLEN             (64)
+#define ELOG_LINE_MAXLEN        (ELOG_MAXLEN + 24) // "[time] " + message + " ...\r\n"
+#define ELOG_ISR_RECORDS        (16) // Must be a power of two
+#define ELOG_RATE_SITES         (8)
+#define ELOG_RATE_MAX           (5)
+#define ELOG_RATE_WINDOW        (1000)
+#define ELOG_DEDUP_TIMEOUT      (1000)
+
+// Flight recorder: last records kept in RAM across resets and dumped after
+// the next boot. Set to 0 to remove it.
+#ifndef ELOG_FLIGHT_RECORDS
+#define ELOG_FLIGHT_RECORDS     (64)
+#endif
 
 #ifdef EBOARD_CONFIG_VERBOSE
 #define ELOG(...)\
     taskENTER_CRITICAL();\
     {\
-      elog_msg_len = snprintf(elog_msg, (ELOG_MAXLEN - 1), __VA_ARGS__);\
-      eboard_log(elog_msg);\
+      eboard_log_flush();\
+      if(eboard_log_site_allow(__FILE__, __LINE__))\
+      {\
+        elog_msg_len = eformat_snprintf(elog_msg, (ELOG_MAXLEN - 1), __VA_ARGS__);\
+        eboard_log(elog_msg);\
+      }\
     }\
     taskEXIT_CRITICAL()
+
+// Interrupt safe log: only stores a binary record (format pointer and up to
+// two integer arguments), the text is built later from task context by
+// eboard_log_flush(). The format string must be a literal.
+#define ELOG_ISR(...)           ELOG_ISR_(__VA_ARGS__, 0, 0)
+#define ELOG_ISR_(fmt, arg0, arg1, ...)\
+    eboard_log_isr((fmt), (uint32_t)(arg0), (uint32_t)(arg1))
+
+// Flight recorder only: costs no formatting and no UART bandwidth, usable
+// from any context. Same argument rules as ELOG_ISR.
+#define ELOG_TRACE(...)         ELOG_TRACE_(__VA_ARGS__, 0, 0)
+#define ELOG_TRACE_(fmt, arg0, arg1, ...)\
+    eboard_log_trace((fmt), (uint32_t)(arg0), (uint32_t)(arg1))
 #else
 #define ELOG(...)
+#define ELOG_ISR(...)
+#define ELOG_TRACE(...)
 #endif
 
+// Actual period histogram of eboard_periodic_t, see eboard_periodic_release()
+#define EBOARD_PERIODIC_HIST_BINS 8
+
+// Periodic releases that can be registered, see eboard_periodic_stats()
+#define EBOARD_PERIODIC_MAX       4
+
+// Words of eboard_hal_port_image_layout()
+#define EBOARD_IMAGE_LAYOUT_WORDS 4
+
+// Timer driven input sampling, see EBOARD_CONFIG_INPUT_DMA: one sample every
+// EBOARD_GPIO_SAMPLE_PERIOD_MS, handed over in blocks
+#define EBOARD_GPIO_SAMPLE_PERIOD_MS 1
+#define EBOARD_GPIO_SAMPLE_BLOCK     16
+
 /********************** typedef **********************************************/
 
 typedef enum
@@ -77,6 +124,46 @@ typedef enum
   EBOARD_GPIO__CNT,
 } eboard_gpio_idx_t;
 
+typedef void (*eboard_gpio_irq_t)(eboard_gpio_idx_t idx, bool value, uint64_t time, void* arg);
+
+// Block of input samples, oldest first: bit n of a sample holds the level of
+// eboard_gpio_idx_t n, time is the one of the last sample.
+typedef void (*eboard_gpio_samples_t)(const uint32_t* samples, size_t count, uint64_t time, void* arg);
+
+// Received bytes are waiting in the UART buffer, from its interrupt
+typedef void (*eboard_uart_rx_t)(void* arg);
+
+typedef struct
+{
+  uint64_t time;
+  const char* fmt;
+  uint32_t arg[2];
+} eboard_log_record_t;
+
+// 32-bit tick count extended to a monotonic 64-bit time, for the ports. See
+// eboard_time_ext_ticks() and eboard_time_ext_us().
+typedef struct
+{
+  uint32_t last;
+  uint32_t high;
+  uint64_t last_us;
+} eboard_time_ext_t;
+
+// Fixed rate release on absolute times, with jitter and overrun statistics.
+// Times are in eboard_osal_port_get_time() units.
+typedef struct
+{
+  uint32_t period;
+  uint32_t next;
+  uint32_t last;
+  bool running;
+  uint32_t releases;
+  uint32_t overruns;
+  uint32_t min;
+  uint32_t max;
+  uint32_t hist[EBOARD_PERIODIC_HIST_BINS];
+} eboard_periodic_t;
+
 /********************** external data declaration ****************************/
 
 extern char* const elog_msg;
@@ -86,8 +173,56 @@ extern int elog_msg_len;
 
 uint32_t eboard_osal_port_get_time(void);
 
+uint64_t eboard_osal_port_get_time_ms(void);
+
+uint64_t eboard_osal_port_get_time_us(void);
+
 void eboard_osal_port_delay(uint32_t time_ms);
 
+void eboard_osal_port_delay_until(uint32_t* pwake_time, uint32_t period);
+
+void eboard_osal_port_critical_enter(void);
+
+void eboard_osal_port_critical_exit(void);
+
+uint32_t eboard_osal_port_isr_lock(void);
+
+void eboard_osal_port_isr_unlock(uint32_t state);
+
+// Monotonic time since boot. 64 bits never wrap, so deltas are plain
+// subtractions. Safe from tasks and interrupts.
+uint64_t eboard_time_ms(void);
+
+uint64_t eboard_time_us(void);
+
+uint64_t eboard_time_ext_ticks(eboard_time_ext_t* ext, uint32_t ticks);
+
+uint64_t eboard_time_ext_us(eboard_time_ext_t* ext, uint32_t ticks, uint32_t elapsed, uint32_t load, uint32_t tick_us);
+
+#ifdef EBOARD_CONFIG_TIME_SIM
+// Host simulation backend, see eboard_time_sim.c: time only moves when told
+// to.
+void eboard_time_sim_set(uint64_t time_us);
+
+void eboard_time_sim_advance(uint64_t delta_us);
+#endif
+
+void eboard_periodic_init(eboard_periodic_t* periodic, uint32_t period);
+
+void eboard_periodic_start(eboard_periodic_t* periodic);
+
+bool eboard_periodic_due(const eboard_periodic_t* periodic);
+
+uint32_t eboard_periodic_timeout(const eboard_periodic_t* periodic);
+
+uint32_t eboard_periodic_release(eboard_periodic_t* periodic);
+
+uint32_t eboard_periodic_wait(eboard_periodic_t* periodic);
+
+bool eboard_periodic_register(eboard_periodic_t* periodic, const char* name);
+
+const char* eboard_periodic_stats(uint32_t index, eboard_periodic_t* stats);
+
 void eboard_uart_init(void* phuart);
 
 void eboard_gpio_init(eboard_gpio_idx_t idx, void* hgpio);
@@ -96,6 +231,14 @@ void eboard_gpio_write(eboard_gpio_idx_t idx, bool value);
 
 bool eboard_gpio_read(eboard_gpio_idx_t idx);
 
+uint32_t eboard_gpio_read_inputs(void);
+
+void eboard_gpio_irq_register(eboard_gpio_idx_t idx, eboard_gpio_irq_t callback, void* arg);
+
+void eboard_gpio_samples_register(eboard_gpio_samples_t callback, void* arg);
+
+void eboard_gpio_samples_enable(bool enable);
+
 void eboard_led_red(bool value);
 
 void eboard_led_green(bool value);
@@ -106,6 +249,8 @@ bool eboard_switch(void);
 
 size_t eboard_uart_tx_len(void);
 
+size_t eboard_uart_tx_free(void);
+
 size_t eboard_uart_write(const uint8_t *buffer, size_t size);
 
 size_t eboard_uart_write_byte(uint8_t byte);
@@ -122,18 +267,46 @@ size_t eboard_uart_read_byte(uint8_t* pbyte);
 
 size_t eboard_uart_sread(char *str, size_t max_size);
 
+void eboard_uart_rx_register(eboard_uart_rx_t callback, void* arg);
+
 void eboard_hal_port_uart_error(void* huart);
 
 void eboard_hal_port_uart_rx_irq(void* huart, uint16_t size);
 
 void eboard_hal_port_uart_tx_irq(void* huart);
 
+bool eboard_hal_port_is_rom(const void* ptr);
+
+// Section ends of the firmware image, they move with almost any change.
+void eboard_hal_port_image_layout(uint32_t layout[EBOARD_IMAGE_LAYOUT_WORDS]);
+
 void eboard_hal_port_gpio_write(void* handle, bool value);
 
 bool eboard_hal_port_gpio_read(void* handle);
 
+void eboard_hal_port_gpio_irq(void* handle);
+
+void eboard_hal_port_gpio_edge(void* handle, bool value, uint64_t time);
+
+// True when a block of samples is to be handed over, see
+// eboard_gpio_samples_enable(). Lets the port skip the conversion.
+bool eboard_hal_port_gpio_samples_wanted(bool changed);
+
+void eboard_hal_port_gpio_samples(const uint32_t* samples, size_t count, uint64_t time);
+
+// Starts timer driven sampling of the inputs, see EBOARD_CONFIG_INPUT_DMA.
+void eboard_hal_port_gpio_sampling_start(void);
+
 void eboard_log(const char* str);
 
+bool eboard_log_site_allow(const char* file, uint32_t line);
+
+void eboard_log_isr(const char* fmt, uint32_t arg0, uint32_t arg1);
+
+void eboard_log_trace(const char* fmt, uint32_t arg0, uint32_t arg1);
+
+void eboard_log_flush(void);
+
 void eboard_init(void);
 
 /********************** End of CPP guard *************************************/
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : edebounce.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef INC_EDEBOUNCE_H_
+#define INC_EDEBOUNCE_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/********************** macros ***********************************************/
+
+#define EDEBOUNCE_COUNTER_BITS  (2)    // cnt0 and cnt1, fixed by edebounce_t
+#define EDEBOUNCE_SAMPLES       (1 << EDEBOUNCE_COUNTER_BITS)
+
+/********************** typedef **********************************************/
+
+/*
+ * Debouncer for up to 32 inputs packed in one word. Every input owns a 2 bit
+ * counter stored "vertically": bit n of cnt0/cnt1 are the low/high bits of
+ * input n counter, so all inputs are filtered with a few word operations per
+ * sample. An input changes its debounced state after EDEBOUNCE_SAMPLES
+ * consecutive samples that differ from it, when its counter wraps back to 0;
+ * any sample that agrees restarts its count. The depth is fixed by the
+ * number of counter words, it is not a tuning knob.
+ */
+typedef struct
+{
+  uint32_t state;
+  uint32_t cnt0;
+  uint32_t cnt1;
+} edebounce_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void edebounce_init(edebounce_t *db, uint32_t initial);
+
+uint32_t edebounce_sample(edebounce_t *db, uint32_t sample);
+
+uint32_t edebounce_state(const edebounce_t *db);
+
+uint32_t edebounce_pending(const edebounce_t *db);
+
+bool edebounce_is_settled(const edebounce_t *db);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_EDEBOUNCE_H_ */
+/********************** end of file ******************************************/
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : ehsm.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef LIB_INC_EHSM_H_
+#define LIB_INC_EHSM_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/********************** macros ***********************************************/
+
+#define EHSM_NONE               (0xff) // No state: parent of the top states
+#define EHSM_DEPTH_MAX          (4)    // Nesting levels of a state table
+
+// Entries of a transition table, entries left out pass the signal on to the
+// parent state. A transition to the handling state itself exits and enters
+// it again; EHSM_INTERNAL runs the action without leaving the state.
+#define EHSM_TRAN(target_, action_)     {handled: true, target: (target_), action: (action_)}
+#define EHSM_INTERNAL(action_)          {handled: true, target: EHSM_NONE, action: (action_)}
+#define EHSM_IGNORE                     EHSM_INTERNAL(NULL)
+
+#define EHSM_STATE(name_, parent_, entry_, exit_) \
+  {name: #name_, parent: (parent_), entry: (entry_), exit: (exit_)}
+
+// Definition of a machine from its [state][signal] transition table
+#define EHSM_DEF(name_, states_, transitions_) \
+  {name: (name_), states: (states_), transitions: &(transitions_)[0][0], \
+      state_cnt: sizeof(transitions_) / sizeof((transitions_)[0]), \
+      signal_cnt: sizeof((transitions_)[0]) / sizeof((transitions_)[0][0])}
+
+/********************** typedef **********************************************/
+
+typedef struct ehsm_s ehsm_t;
+
+// Entry, exit and transition actions, event is the one being dispatched
+// (NULL for the entries run by ehsm_init).
+typedef void (*ehsm_action_t)(ehsm_t* hsm, const void* event);
+
+// Called after every transition, source is the state that was active
+typedef void (*ehsm_trace_t)(const ehsm_t* hsm, uint8_t source, uint8_t target, uint8_t signal);
+
+typedef struct
+{
+  const char* name;
+  uint8_t parent;
+  ehsm_action_t entry;
+  ehsm_action_t exit;
+} ehsm_state_t;
+
+typedef struct
+{
+  bool handled;
+  uint8_t target;
+  ehsm_action_t action;
+} ehsm_transition_t;
+
+typedef struct
+{
+  const char* name;
+  const ehsm_state_t* states;
+  const ehsm_transition_t* transitions;
+  uint8_t state_cnt;
+  uint8_t signal_cnt;
+} ehsm_def_t;
+
+struct ehsm_s
+{
+  const ehsm_def_t* def;
+  uint8_t id;    // Tells the instances apart in the traces
+  uint8_t state;
+  void* ctx;
+  ehsm_trace_t trace;
+};
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void ehsm_init(ehsm_t* hsm, const ehsm_def_t* def, uint8_t id, uint8_t initial, void* ctx, ehsm_trace_t trace);
+
+bool ehsm_dispatch(ehsm_t* hsm, uint8_t signal, const void* event);
+
+bool ehsm_is_in(const ehsm_t* hsm, uint8_t state);
+
+void ehsm_trace_flight(const ehsm_t* hsm, uint8_t source, uint8_t target, uint8_t signal);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIB_INC_EHSM_H_ */
+/********************** end of file ******************************************/
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : epool.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef LIB_INC_EPOOL_H_
+#define LIB_INC_EPOOL_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/********************** macros ***********************************************/
+
+// Only DEBUG builds keep the map of the blocks in use, epool_t has the same
+// layout either way.
+#ifdef DEBUG
+#define EPOOL_MAP_(name, n)             static uint32_t name##_map_[((n) + 31) / 32];
+#define EPOOL_MAP_INIT_(name)           , map: name##_map_
+#else
+#define EPOOL_MAP_(name, n)
+#define EPOOL_MAP_INIT_(name)
+#endif
+
+// Defines the pool "name" of n blocks, each one able to hold a "type".
+// Storage is static and no init call is needed.
+#define EPOOL_DEFINE(name, type, n) \
+  static union { type item; void* link; } name##_blocks_[n]; \
+  EPOOL_MAP_(name, n) \
+  epool_t name = {blocks: (uint8_t*)name##_blocks_, block_size: sizeof(name##_blocks_[0]), count: (n), \
+      label: #name EPOOL_MAP_INIT_(name)}
+
+/********************** typedef **********************************************/
+
+typedef struct
+{
+  size_t in_use;
+  size_t peak;
+  uint32_t fails;
+  uint32_t bad_frees; // Counted by DEBUG builds only
+} epool_stats_t;
+
+typedef struct
+{
+  uint8_t* blocks;
+  size_t block_size;
+  size_t count;
+  const char* label;
+  uint32_t* map; // Blocks in use, NULL unless defined by a DEBUG build
+  void* free_list;
+  size_t fresh;
+  epool_stats_t stats;
+} epool_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+void* epool_alloc(epool_t* pool);
+
+void epool_free(epool_t* pool, void* block);
+
+void epool_stats(const epool_t* pool, epool_stats_t* stats);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIB_INC_EPOOL_H_ */
+/********************** end of file ******************************************/
@@ -34,6 +34,8 @@ void euart_init(euart_t *phandle, void* phardware_handle, uint8_t* ptx_buffer, s
 
 size_t euart_write_buffer_len(euart_t *phandle);
 
+size_t euart_write_buffer_free(euart_t *phandle);
+
 size_t euart_write(euart_t *phandle, const uint8_t *buffer, size_t size);
 
 size_t euart_read_buffer_len(euart_t *phandle);
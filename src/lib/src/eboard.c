@@ -42,6 +42,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdarg.h>
 
 #include "euart.h"
 #include "eboard.h"
@@ -52,6 +53,8 @@
 #define NEW_LINE_               ("\r\n")
 #define RB_TX_BUFFER_SIZE_      (1024)
 #define RB_RX_BUFFER_SIZE_      (256)
+#define ELOG_ISR_MASK_          (ELOG_ISR_RECORDS - 1)
+#define ELOG_FLIGHT_MAGIC_      (0x464c5433) // "FLT3"
 
 /********************** internal data declaration ****************************/
 
@@ -59,17 +62,88 @@ typedef struct
 {
   void* hgpio;
   bool input;
+  eboard_gpio_irq_t irq;
+  void* irq_arg;
 } eboard_gpio_descriptor_t_;
 
+typedef struct
+{
+  const char* file;
+  uint32_t line;
+  uint64_t window;
+  uint32_t count;
+  uint32_t suppressed;
+} elog_site_t_;
+
+typedef struct
+{
+  bool valid;
+  uint32_t hash;
+  char text[ELOG_MAXLEN]; // A longer message is never taken as a repeat
+  uint64_t time;
+  uint32_t repeated;
+} elog_last_t_;
+
+#if 0 < ELOG_FLIGHT_RECORDS
+typedef struct
+{
+  eboard_log_record_t record;
+  uint32_t seq;
+  uint32_t check;
+} elog_flight_entry_t_;
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t size;
+  uint32_t build;
+  elog_flight_entry_t_ entries[ELOG_FLIGHT_RECORDS];
+} elog_flight_t_;
+#endif
+
 /********************** internal functions declaration ***********************/
 
+static uint32_t hash_(const char* str);
+
+static size_t eboard_log_line_(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static bool eboard_log_emit_(const char* line, size_t len);
+
+static void eboard_log_dropped_report_(uint64_t time);
+
+static void eboard_log_write_(uint64_t time, const char* str, bool truncated);
+
+static void eboard_log_note_(uint64_t time, const char* fmt, uint32_t arg0, uint32_t arg1);
+
+static void eboard_log_at_(uint64_t time, const char* str);
+
+static void eboard_log_repeated_report_(uint64_t time);
+
+static void eboard_log_site_report_(elog_site_t_* site, uint64_t time);
+
+static elog_site_t_* eboard_log_site_get_(const char* file, uint32_t line, uint64_t now);
+
+#if 0 < ELOG_FLIGHT_RECORDS
+static uint32_t flight_check_(const eboard_log_record_t* record, uint32_t seq);
+
+static bool flight_entry_valid_(const elog_flight_entry_t_* entry, uint32_t seq);
+
+static void flight_put_(const eboard_log_record_t* record);
+
+static uint32_t flight_build_id_(void);
+
+static void flight_init_(void);
+
+static void flight_dump_(void);
+#endif
+
 /********************** internal data definition *****************************/
 
 static eboard_gpio_descriptor_t_ gpios_[EBOARD_GPIO__CNT] = {
-  {hgpio: NULL, input: false}, // LED3
-  {hgpio: NULL, input: false}, // LED1
-  {hgpio: NULL, input: false}, // LED2
-  {hgpio: NULL, input: true}, // USER BTN
+  {hgpio: NULL, input: false, irq: NULL, irq_arg: NULL}, // LED3
+  {hgpio: NULL, input: false, irq: NULL, irq_arg: NULL}, // LED1
+  {hgpio: NULL, input: false, irq: NULL, irq_arg: NULL}, // LED2
+  {hgpio: NULL, input: true, irq: NULL, irq_arg: NULL}, // USER BTN
 };
 
 static uint8_t tx_buffer_[RB_TX_BUFFER_SIZE_];
@@ -77,15 +151,324 @@ static uint8_t rx_buffer_[RB_RX_BUFFER_SIZE_];
 static euart_t heuart_;
 static euart_t* const pheuart_ = &heuart_;
 
+// Receiver of the sampled input blocks, see EBOARD_CONFIG_INPUT_DMA
+static eboard_gpio_samples_t gpio_samples_;
+static void* gpio_samples_arg_;
+static volatile bool gpio_samples_on_;
+
+// Told about received bytes, see eboard_uart_rx_register()
+static eboard_uart_rx_t uart_rx_;
+static void* uart_rx_arg_;
+
+// Single consumer (task context) / multiple producers (interrupts) ring, the
+// indexes are free running counters.
+static eboard_log_record_t elog_isr_records_[ELOG_ISR_RECORDS];
+static volatile uint32_t elog_isr_w_;
+static volatile uint32_t elog_isr_r_;
+static volatile uint32_t elog_isr_dropped_;
+
+// Rate limit (per ELOG call site) and duplicate collapse state, only touched
+// inside critical sections.
+static elog_site_t_ elog_sites_[ELOG_RATE_SITES];
+static elog_last_t_ elog_last_;
+static char elog_note_buffer_[48];
+static char elog_line_buffer_[ELOG_LINE_MAXLEN];
+static uint32_t elog_dropped_;
+
+// Registered periodic releases, see eboard_periodic_stats()
+static eboard_periodic_t* periodic_registry_[EBOARD_PERIODIC_MAX];
+static const char* periodic_names_[EBOARD_PERIODIC_MAX];
+static uint32_t periodic_cnt_;
+
+#if 0 < ELOG_FLIGHT_RECORDS
+// Left untouched by the startup code, see the .noinit section in the linker
+// scripts. Entries are tagged with a sequence number so the write position
+// is rebuilt from the contents, no index has to survive the reset.
+__attribute__((section(".noinit"))) static elog_flight_t_ elog_flight_;
+static uint32_t elog_flight_w_;
+static uint32_t elog_flight_dump_r_;
+static uint32_t elog_flight_dump_end_;
+static uint32_t elog_flight_lost_;
+#endif
+
 /********************** external data definition *****************************/
 
-static char elog_buffer_[32];
 static char elog_user_buffer_[ELOG_MAXLEN];
 char* const elog_msg = elog_user_buffer_;
 int elog_msg_len;
 
 /********************** internal functions definition ************************/
 
+static uint32_t hash_(const char* str)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  while('\0' != *str)
+  {
+    hash ^= (uint8_t)*str++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/*
+ * Formats one UART line in elog_line_buffer_ and returns its length. A body
+ * that does not fit is cut, the "\r\n" is always kept.
+ */
+static size_t eboard_log_line_(const char* fmt, ...)
+{
+  const size_t body_max = sizeof(elog_line_buffer_) - sizeof("\r\n");
+  va_list args;
+
+  va_start(args, fmt);
+  int len = eformat_vsnprintf(elog_line_buffer_, body_max + 1, fmt, args);
+  va_end(args);
+
+  size_t body = ((0 <= len) && ((size_t)len < body_max)) ? (size_t)len : body_max;
+  elog_line_buffer_[body++] = '\r';
+  elog_line_buffer_[body++] = '\n';
+  elog_line_buffer_[body] = '\0';
+  return body;
+}
+
+static bool eboard_log_emit_(const char* line, size_t len)
+{
+  // Writers are serialized and the TX interrupt only releases space, so a
+  // record that fits now is written whole.
+  if(eboard_uart_tx_free() < len)
+  {
+    return false;
+  }
+  eboard_uart_write((const uint8_t*)line, len);
+  return true;
+}
+
+static void eboard_log_dropped_report_(uint64_t time)
+{
+  if(0 < elog_dropped_)
+  {
+    size_t len = eboard_log_line_("[%llu] %lu records dropped", time, elog_dropped_);
+    if(eboard_log_emit_(elog_line_buffer_, len))
+    {
+      elog_dropped_ = 0;
+    }
+  }
+}
+
+static void eboard_log_write_(uint64_t time, const char* str, bool truncated)
+{
+  eboard_log_dropped_report_(time);
+
+  size_t len = eboard_log_line_("[%llu] %s%s", time, str, truncated ? " ..." : "");
+  if((0 < elog_dropped_) || !eboard_log_emit_(elog_line_buffer_, len))
+  {
+    // Keep ordering: nothing is admitted until the drop marker fits
+    elog_dropped_++;
+  }
+}
+
+static void eboard_log_note_(uint64_t time, const char* fmt, uint32_t arg0, uint32_t arg1)
+{
+  eformat_snprintf(elog_note_buffer_, sizeof(elog_note_buffer_), fmt, arg0, arg1);
+  eboard_log_write_(time, elog_note_buffer_, false);
+}
+
+static void eboard_log_repeated_report_(uint64_t time)
+{
+  if(0 < elog_last_.repeated)
+  {
+    eboard_log_note_(time, "last message repeated %lu times", elog_last_.repeated, 0);
+    elog_last_.repeated = 0;
+  }
+}
+
+static void eboard_log_at_(uint64_t time, const char* str)
+{
+  // The hash rejects most messages at once, the bytes decide: two messages
+  // can share a hash.
+  uint32_t hash = hash_(str);
+  if(elog_last_.valid && (hash == elog_last_.hash) && (0 == strncmp(str, elog_last_.text, sizeof(elog_last_.text))))
+  {
+    elog_last_.repeated++;
+    elog_last_.time = time;
+    return;
+  }
+
+  eboard_log_repeated_report_(time);
+  elog_last_.valid = true;
+  elog_last_.hash = hash;
+  strncpy(elog_last_.text, str, sizeof(elog_last_.text) - 1);
+  elog_last_.text[sizeof(elog_last_.text) - 1] = '\0';
+  elog_last_.time = time;
+  eboard_log_write_(time, str, (ELOG_MAXLEN - 1) <= elog_msg_len);
+}
+
+static void eboard_log_site_report_(elog_site_t_* site, uint64_t time)
+{
+  if(0 < site->suppressed)
+  {
+    eboard_log_note_(time, "%lu messages suppressed from line %lu", site->suppressed, site->line);
+    site->suppressed = 0;
+  }
+}
+
+static elog_site_t_* eboard_log_site_get_(const char* file, uint32_t line, uint64_t now)
+{
+  elog_site_t_* victim = elog_sites_;
+  for(elog_site_t_* site = elog_sites_; site < (elog_sites_ + ELOG_RATE_SITES); ++site)
+  {
+    if((site->file == file) && (site->line == line))
+    {
+      return site;
+    }
+    if(NULL == site->file)
+    {
+      victim = site;
+    }
+    else if((NULL != victim->file) && ((now - victim->window) < (now - site->window)))
+    {
+      victim = site;
+    }
+  }
+
+  // Reuse a free slot or the least recently opened window
+  eboard_log_site_report_(victim, now);
+  victim->file = file;
+  victim->line = line;
+  victim->window = now;
+  victim->count = 0;
+  return victim;
+}
+
+#if 0 < ELOG_FLIGHT_RECORDS
+static uint32_t flight_check_(const eboard_log_record_t* record, uint32_t seq)
+{
+  uint32_t words[] = {(uint32_t)record->time, (uint32_t)(record->time >> 32), (uint32_t)(uintptr_t)record->fmt, record->arg[0], record->arg[1], seq};
+  uint32_t check = ELOG_FLIGHT_MAGIC_;
+  for(size_t i = 0; i < (sizeof(words) / sizeof(words[0])); ++i)
+  {
+    check = ((check << 5) | (check >> 27)) ^ words[i];
+    check *= 16777619u;
+  }
+  return check;
+}
+
+static bool flight_entry_valid_(const elog_flight_entry_t_* entry, uint32_t seq)
+{
+  return (entry->seq == seq)
+      && (entry->check == flight_check_(&entry->record, seq))
+      && eboard_hal_port_is_rom(entry->record.fmt);
+}
+
+static void flight_put_(const eboard_log_record_t* record)
+{
+  // Called with interrupts masked
+  uint32_t seq = elog_flight_w_++;
+  elog_flight_entry_t_* entry = elog_flight_.entries + (seq % ELOG_FLIGHT_RECORDS);
+  entry->record = *record;
+  entry->seq = seq;
+  entry->check = flight_check_(record, seq);
+}
+
+/*
+ * Identifies the firmware image. Records hold pointers to format strings in
+ * .rodata, after a reflash they would pass eboard_hal_port_is_rom() and be
+ * formatted against the new image. The section ends move with almost any
+ * change, the build time of this file catches the rest when it is rebuilt.
+ */
+static uint32_t flight_build_id_(void)
+{
+  uint32_t words[EBOARD_IMAGE_LAYOUT_WORDS];
+  eboard_hal_port_image_layout(words);
+  uint32_t id = hash_(__DATE__ " " __TIME__);
+  for(size_t i = 0; i < (sizeof(words) / sizeof(words[0])); ++i)
+  {
+    id = ((id << 5) | (id >> 27)) ^ words[i];
+    id *= 16777619u;
+  }
+  return id;
+}
+
+static void flight_init_(void)
+{
+  uint32_t build = flight_build_id_();
+
+  elog_flight_w_ = 0;
+  elog_flight_dump_r_ = 0;
+  elog_flight_dump_end_ = 0;
+  elog_flight_lost_ = 0;
+
+  if((ELOG_FLIGHT_MAGIC_ != elog_flight_.magic) || (ELOG_FLIGHT_RECORDS != elog_flight_.size)
+     || (build != elog_flight_.build))
+  {
+    // Power on, or another firmware: nothing to recover
+    memset(&elog_flight_, 0, sizeof(elog_flight_));
+    elog_flight_.magic = ELOG_FLIGHT_MAGIC_;
+    elog_flight_.size = ELOG_FLIGHT_RECORDS;
+    elog_flight_.build = build;
+    return;
+  }
+
+  bool found = false;
+  uint32_t last = 0;
+  for(uint32_t slot = 0; slot < ELOG_FLIGHT_RECORDS; ++slot)
+  {
+    elog_flight_entry_t_* entry = elog_flight_.entries + slot;
+    if(((entry->seq % ELOG_FLIGHT_RECORDS) == slot) && flight_entry_valid_(entry, entry->seq))
+    {
+      if(!found || ((int32_t)(entry->seq - last) > 0))
+      {
+        last = entry->seq;
+        found = true;
+      }
+    }
+  }
+
+  if(found)
+  {
+    // New records keep the sequence going, the dump skips whatever they
+    // overwrite before it is sent.
+    elog_flight_w_ = last + 1;
+    elog_flight_dump_end_ = elog_flight_w_;
+    elog_flight_dump_r_ = (ELOG_FLIGHT_RECORDS < elog_flight_w_) ? (elog_flight_w_ - ELOG_FLIGHT_RECORDS) : 0;
+  }
+}
+
+static void flight_dump_(void)
+{
+  // Called from task context inside a critical section
+  while(elog_flight_dump_r_ != elog_flight_dump_end_)
+  {
+    uint32_t seq = elog_flight_dump_r_;
+    elog_flight_entry_t_ entry = elog_flight_.entries[seq % ELOG_FLIGHT_RECORDS];
+    if(!flight_entry_valid_(&entry, seq))
+    {
+      elog_flight_lost_++;
+      elog_flight_dump_r_++;
+      continue;
+    }
+
+    eformat_snprintf(elog_note_buffer_, sizeof(elog_note_buffer_), entry.record.fmt, entry.record.arg[0], entry.record.arg[1]);
+    size_t len = eboard_log_line_("[%llu] flight: %s", entry.record.time, elog_note_buffer_);
+    if(!eboard_log_emit_(elog_line_buffer_, len))
+    {
+      // Retried on the next flush
+      return;
+    }
+    elog_flight_dump_r_++;
+  }
+
+  if(0 < elog_flight_lost_)
+  {
+    size_t len = eboard_log_line_("flight: %lu records lost", elog_flight_lost_);
+    if(eboard_log_emit_(elog_line_buffer_, len))
+    {
+      elog_flight_lost_ = 0;
+    }
+  }
+}
+#endif
+
 /********************** external functions definition ************************/
 
 void eboard_uart_init(void* phuart)
@@ -125,6 +508,54 @@ bool eboard_gpio_read(eboard_gpio_idx_t idx)
   return eboard_hal_port_gpio_read((void*)hgpio->hgpio);
 }
 
+/*
+ * Snapshot of every input, bit n holds the level of eboard_gpio_idx_t n.
+ */
+uint32_t eboard_gpio_read_inputs(void)
+{
+  uint32_t inputs = 0;
+  for (eboard_gpio_idx_t idx = 0; idx < EBOARD_GPIO__CNT; ++idx)
+  {
+    eboard_gpio_descriptor_t_* hgpio = gpios_ + idx;
+    if(hgpio->input && eboard_hal_port_gpio_read((void*)hgpio->hgpio))
+    {
+      inputs |= (1u << idx);
+    }
+  }
+  return inputs;
+}
+
+void eboard_gpio_irq_register(eboard_gpio_idx_t idx, eboard_gpio_irq_t callback, void* arg)
+{
+  if(EBOARD_GPIO__CNT <= idx)
+  {
+    return;
+  }
+
+  uint32_t state = eboard_osal_port_isr_lock();
+  gpios_[idx].irq_arg = arg;
+  gpios_[idx].irq = callback;
+  eboard_osal_port_isr_unlock(state);
+}
+
+void eboard_gpio_samples_register(eboard_gpio_samples_t callback, void* arg)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  gpio_samples_arg_ = arg;
+  gpio_samples_ = callback;
+  eboard_osal_port_isr_unlock(state);
+}
+
+/*
+ * Blocks with a change are always handed over. While enabled the others are
+ * as well, for a receiver that is counting samples; while disabled an idle
+ * input costs the interrupt of each block and nothing else.
+ */
+void eboard_gpio_samples_enable(bool enable)
+{
+  gpio_samples_on_ = enable;
+}
+
 void eboard_led_red(bool value)
 {
   eboard_gpio_write(EBOARD_GPIO_LEDR, value);
@@ -150,6 +581,11 @@ size_t eboard_uart_tx_len(void)
   return euart_write_buffer_len(pheuart_);
 }
 
+size_t eboard_uart_tx_free(void)
+{
+  return euart_write_buffer_free(pheuart_);
+}
+
 size_t eboard_uart_write(const uint8_t *buffer, size_t size)
 {
   return euart_write(pheuart_, buffer, size);
@@ -167,7 +603,7 @@ size_t eboard_uart_swrite(const char *str)
   {
     return 0;
   }
-  return eboard_uart_write((const uint8_t*)str, len + 1);
+  return eboard_uart_write((const uint8_t*)str, len);
 }
 
 size_t eboard_uart_swrite_line(const char *str)
@@ -199,12 +635,337 @@ size_t eboard_uart_sread(char *str, size_t max_size)
   return ret;
 }
 
+/*
+ * The callback runs in the UART interrupt after each reception, a reader can
+ * then block until there is something to read instead of polling.
+ */
+void eboard_uart_rx_register(eboard_uart_rx_t callback, void* arg)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  uart_rx_arg_ = arg;
+  uart_rx_ = callback;
+  eboard_osal_port_isr_unlock(state);
+}
+
 void eboard_log(const char* str)
 {
-  sprintf(elog_buffer_, "[%lu] ", eboard_osal_port_get_time());\
-  eboard_uart_swrite(elog_buffer_);
-  eboard_uart_swrite(str);
-  eboard_uart_swrite_line((elog_msg_len < (ELOG_MAXLEN - 1)) ? "" : " ...");
+  eboard_log_at_(eboard_time_ms(), str);
+}
+
+bool eboard_log_site_allow(const char* file, uint32_t line)
+{
+  uint64_t now = eboard_time_ms();
+  elog_site_t_* site = eboard_log_site_get_(file, line, now);
+  if(ELOG_RATE_WINDOW <= (now - site->window))
+  {
+    eboard_log_site_report_(site, now);
+    site->window = now;
+    site->count = 0;
+  }
+
+  if(ELOG_RATE_MAX <= site->count)
+  {
+    site->suppressed++;
+    return false;
+  }
+  site->count++;
+  return true;
+}
+
+void eboard_log_isr(const char* fmt, uint32_t arg0, uint32_t arg1)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  uint32_t w = elog_isr_w_;
+  if(ELOG_ISR_RECORDS <= (w - elog_isr_r_))
+  {
+    elog_isr_dropped_++;
+  }
+  else
+  {
+    eboard_log_record_t* record = elog_isr_records_ + (w & ELOG_ISR_MASK_);
+    record->time = eboard_time_ms();
+    record->fmt = fmt;
+    record->arg[0] = arg0;
+    record->arg[1] = arg1;
+    __sync_synchronize();
+    elog_isr_w_ = w + 1;
+#if 0 < ELOG_FLIGHT_RECORDS
+    flight_put_(record);
+#endif
+  }
+  eboard_osal_port_isr_unlock(state);
+}
+
+void eboard_log_trace(const char* fmt, uint32_t arg0, uint32_t arg1)
+{
+#if 0 < ELOG_FLIGHT_RECORDS
+  uint32_t state = eboard_osal_port_isr_lock();
+  eboard_log_record_t record = {time: eboard_time_ms(), fmt: fmt, arg: {arg0, arg1}};
+  flight_put_(&record);
+  eboard_osal_port_isr_unlock(state);
+#endif
+}
+
+void eboard_log_flush(void)
+{
+  // The idle hook and every ELOG caller consume the ring, so a record is
+  // claimed and r_ advanced inside the critical section; a consumer that
+  // was preempted between the test and the claim finds the ring empty.
+  for(;;)
+  {
+    eboard_osal_port_critical_enter();
+    if(elog_isr_r_ == elog_isr_w_)
+    {
+      eboard_osal_port_critical_exit();
+      break;
+    }
+    eboard_log_record_t record = elog_isr_records_[elog_isr_r_ & ELOG_ISR_MASK_];
+    __sync_synchronize();
+    elog_isr_r_++;
+
+    elog_msg_len = eformat_snprintf(elog_msg, (ELOG_MAXLEN - 1), record.fmt, record.arg[0], record.arg[1]);
+    eboard_log_at_(record.time, elog_msg);
+    eboard_osal_port_critical_exit();
+  }
+
+  if(0 < elog_isr_dropped_)
+  {
+    uint32_t state = eboard_osal_port_isr_lock();
+    uint32_t dropped = elog_isr_dropped_;
+    elog_isr_dropped_ = 0;
+    eboard_osal_port_isr_unlock(state);
+
+    eboard_osal_port_critical_enter();
+    eboard_log_note_(eboard_time_ms(), "%lu isr records dropped", dropped, 0);
+    eboard_osal_port_critical_exit();
+  }
+
+  // Pending repeat and suppression counters are reported once their source
+  // has been quiet for a while, even if nothing else is logged.
+  uint64_t now = eboard_time_ms();
+  eboard_osal_port_critical_enter();
+  if((0 < elog_last_.repeated) && (ELOG_DEDUP_TIMEOUT <= (now - elog_last_.time)))
+  {
+    eboard_log_repeated_report_(now);
+  }
+  for(elog_site_t_* site = elog_sites_; site < (elog_sites_ + ELOG_RATE_SITES); ++site)
+  {
+    if((0 < site->suppressed) && (ELOG_RATE_WINDOW <= (now - site->window)))
+    {
+      eboard_log_site_report_(site, now);
+    }
+  }
+  eboard_log_dropped_report_(now);
+#if 0 < ELOG_FLIGHT_RECORDS
+  flight_dump_();
+#endif
+  eboard_osal_port_critical_exit();
+}
+
+// time, see eboard_time_sim.c for the host simulation backend
+#ifndef EBOARD_CONFIG_TIME_SIM
+uint64_t eboard_time_ms(void)
+{
+  return eboard_osal_port_get_time_ms();
+}
+
+uint64_t eboard_time_us(void)
+{
+  return eboard_osal_port_get_time_us();
+}
+#endif
+
+/*
+ * Extends a 32-bit tick count to 64 bits, to be called with interrupts
+ * masked and at least once per half wrap (24 days at 1 kHz). A count behind
+ * the last one, as after a read that counted a pending tick, returns the
+ * last one: the time never goes back.
+ */
+uint64_t eboard_time_ext_ticks(eboard_time_ext_t* ext, uint32_t ticks)
+{
+  if((int32_t)(ticks - ext->last) < 0)
+  {
+    ticks = ext->last;
+  }
+  else if(ticks < ext->last)
+  {
+    ext->high++;
+  }
+  ext->last = ticks;
+  return ((uint64_t)ext->high << 32) | ticks;
+}
+
+/*
+ * Same, in us, with elapsed of load timer counts into the current tick of
+ * tick_us. The tick count stands still while the scheduler is suspended but
+ * the timer keeps wrapping: the result is held at the highest one returned
+ * until the count moves again, it never steps back.
+ */
+uint64_t eboard_time_ext_us(eboard_time_ext_t* ext, uint32_t ticks, uint32_t elapsed, uint32_t load, uint32_t tick_us)
+{
+  if(load <= elapsed)
+  {
+    elapsed = load - 1;
+  }
+  uint64_t us = (eboard_time_ext_ticks(ext, ticks) * tick_us) + (((uint64_t)elapsed * tick_us) / load);
+  if(us < ext->last_us)
+  {
+    us = ext->last_us;
+  }
+  ext->last_us = us;
+  return us;
+}
+
+// periodic
+void eboard_periodic_init(eboard_periodic_t* periodic, uint32_t period)
+{
+  memset(periodic, 0, sizeof(*periodic));
+  periodic->period = period;
+  periodic->min = UINT32_MAX;
+  eboard_periodic_start(periodic);
+}
+
+/**
+ * (Re)anchors the releases on now, the statistics are kept. The first
+ * release after a start has no previous one and is not measured.
+ */
+void eboard_periodic_start(eboard_periodic_t* periodic)
+{
+  periodic->next = eboard_osal_port_get_time();
+  periodic->running = false;
+}
+
+bool eboard_periodic_due(const eboard_periodic_t* periodic)
+{
+  return (int32_t)(eboard_osal_port_get_time() - periodic->next) >= 0;
+}
+
+uint32_t eboard_periodic_timeout(const eboard_periodic_t* periodic)
+{
+  int32_t left = (int32_t)(periodic->next - eboard_osal_port_get_time());
+  return (0 < left) ? (uint32_t)left : 0;
+}
+
+/**
+ * Records a release at now and schedules the next one a period after the
+ * previous deadline, so the rate does not drift with the work done. When
+ * whole periods were missed they are skipped and counted as overruns.
+ *
+ * hist[0] counts early releases, hist[1] on time ones and hist[n] the ones
+ * n - 1 late, the last bin holds everything later.
+ *
+ * Returns the number of periods missed.
+ */
+uint32_t eboard_periodic_release(eboard_periodic_t* periodic)
+{
+  uint32_t now = eboard_osal_port_get_time();
+  uint32_t missed = 0;
+
+  if(periodic->running)
+  {
+    uint32_t actual = now - periodic->last;
+    uint32_t bin = (actual < periodic->period) ? 0 : (actual - periodic->period + 1);
+    if((EBOARD_PERIODIC_HIST_BINS - 1) < bin)
+    {
+      bin = EBOARD_PERIODIC_HIST_BINS - 1;
+    }
+    periodic->hist[bin]++;
+    periodic->min = (actual < periodic->min) ? actual : periodic->min;
+    periodic->max = (periodic->max < actual) ? actual : periodic->max;
+  }
+  periodic->running = true;
+  periodic->last = now;
+  periodic->releases++;
+
+  int32_t late = (int32_t)(now - periodic->next);
+  if((0 < periodic->period) && (0 <= late))
+  {
+    missed = (uint32_t)late / periodic->period;
+  }
+  periodic->overruns += missed;
+  periodic->next += (missed + 1) * periodic->period;
+  return missed;
+}
+
+/**
+ * Blocks until the next release, for tasks that only run periodically.
+ * Returns the number of periods missed.
+ */
+uint32_t eboard_periodic_wait(eboard_periodic_t* periodic)
+{
+  uint32_t wake_time = periodic->next - periodic->period;
+  eboard_osal_port_delay_until(&wake_time, periodic->period);
+  return eboard_periodic_release(periodic);
+}
+
+/**
+ * Makes the statistics of a periodic release reachable by name, the release
+ * must outlive the registry. Returns false when the registry is full.
+ */
+bool eboard_periodic_register(eboard_periodic_t* periodic, const char* name)
+{
+  bool registered = false;
+
+  eboard_osal_port_critical_enter();
+  if(periodic_cnt_ < EBOARD_PERIODIC_MAX)
+  {
+    periodic_registry_[periodic_cnt_] = periodic;
+    periodic_names_[periodic_cnt_] = name;
+    periodic_cnt_++;
+    registered = true;
+  }
+  eboard_osal_port_critical_exit();
+  return registered;
+}
+
+/**
+ * Copies the statistics of the index-th registered release and returns its
+ * name, NULL past the last one. The owner updates them without a lock, so a
+ * copy may mix two consecutive releases.
+ */
+const char* eboard_periodic_stats(uint32_t index, eboard_periodic_t* stats)
+{
+  const char* name = NULL;
+
+  eboard_osal_port_critical_enter();
+  if(index < periodic_cnt_)
+  {
+    *stats = *periodic_registry_[index];
+    name = periodic_names_[index];
+  }
+  eboard_osal_port_critical_exit();
+  return name;
+}
+
+// port gpio
+void eboard_hal_port_gpio_irq(void* handle)
+{
+  eboard_hal_port_gpio_edge(handle, eboard_hal_port_gpio_read(handle), eboard_time_ms());
+}
+
+void eboard_hal_port_gpio_edge(void* handle, bool value, uint64_t time)
+{
+  for (eboard_gpio_idx_t idx = 0; idx < EBOARD_GPIO__CNT; ++idx)
+  {
+    eboard_gpio_descriptor_t_* hgpio = gpios_ + idx;
+    if((hgpio->hgpio == handle) && hgpio->input && (NULL != hgpio->irq))
+    {
+      hgpio->irq(idx, value, time, hgpio->irq_arg);
+    }
+  }
+}
+
+bool eboard_hal_port_gpio_samples_wanted(bool changed)
+{
+  return (NULL != gpio_samples_) && (changed || gpio_samples_on_);
+}
+
+void eboard_hal_port_gpio_samples(const uint32_t* samples, size_t count, uint64_t time)
+{
+  if(NULL != gpio_samples_)
+  {
+    gpio_samples_(samples, count, time, gpio_samples_arg_);
+  }
 }
 
 // port uart
@@ -216,6 +977,10 @@ void eboard_hal_port_uart_error(void* huart)
 void eboard_hal_port_uart_rx_irq(void* huart, uint16_t size)
 {
   euart_rx_irq(pheuart_, huart, size);
+  if((0 < size) && (NULL != uart_rx_))
+  {
+    uart_rx_(uart_rx_arg_);
+  }
 }
 
 void eboard_hal_port_uart_tx_irq(void* huart)
@@ -225,12 +990,18 @@ void eboard_hal_port_uart_tx_irq(void* huart)
 
 void eboard_init(void)
 {
+#if 0 < ELOG_FLIGHT_RECORDS
+  flight_init_();
+#endif
   eboard_uart_init((void*)p_huart_selected_);
 
   for (eboard_gpio_idx_t idx = 0; idx < EBOARD_GPIO__CNT; ++idx)
   {
     eboard_gpio_init(idx, (void*)(driver_gpios_ + idx));
   }
+#ifdef EBOARD_CONFIG_INPUT_DMA
+  eboard_hal_port_gpio_sampling_start();
+#endif
 }
 
 /********************** end of file ******************************************/
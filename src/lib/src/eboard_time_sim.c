@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : eboard_time_sim.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdint.h>
+
+#include "eboard.h"
+
+/********************** macros and definitions *******************************/
+
+#ifdef EBOARD_CONFIG_TIME_SIM
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static uint64_t time_sim_us_ = 0;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+// Host simulation backend: time only moves when told to. It does not touch
+// the HAL, so it builds on a host together with the HAL free libraries.
+uint64_t eboard_time_ms(void)
+{
+  return time_sim_us_ / 1000;
+}
+
+uint64_t eboard_time_us(void)
+{
+  return time_sim_us_;
+}
+
+void eboard_time_sim_set(uint64_t time_us)
+{
+  time_sim_us_ = time_us;
+}
+
+void eboard_time_sim_advance(uint64_t delta_us)
+{
+  time_sim_us_ += delta_us;
+}
+
+#endif /* EBOARD_CONFIG_TIME_SIM */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : econsole.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "eboard.h"
+#include "eformat.h"
+#include "econsole.h"
+
+/********************** macros and definitions *******************************/
+
+#define OUT_MAXLEN_             (96)
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static void run_(char* line);
+
+static void help_(void);
+
+/********************** internal data definition *****************************/
+
+static const econsole_cmd_t* cmds_ = NULL;
+static size_t cmds_count_ = 0;
+
+static char line_[ECONSOLE_LINE_MAXLEN];
+static size_t line_len_ = 0;
+static bool line_overflow_ = false;
+
+static char out_[OUT_MAXLEN_];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void help_(void)
+{
+  econsole_printf("help: this list\r\n");
+  for(size_t i = 0; i < cmds_count_; ++i)
+  {
+    econsole_printf("%s: %s\r\n", cmds_[i].name, cmds_[i].help);
+  }
+}
+
+static void run_(char* line)
+{
+  char* argv[ECONSOLE_ARGS_MAX];
+  int argc = 0;
+
+  // Split on spaces, extra arguments are dropped
+  for(char* p = strtok(line, " \t"); (NULL != p) && (argc < ECONSOLE_ARGS_MAX); p = strtok(NULL, " \t"))
+  {
+    argv[argc++] = p;
+  }
+  if(0 == argc)
+  {
+    return;
+  }
+
+  if(0 == strcmp(argv[0], "help"))
+  {
+    help_();
+    return;
+  }
+  for(size_t i = 0; i < cmds_count_; ++i)
+  {
+    if(0 == strcmp(argv[0], cmds_[i].name))
+    {
+      cmds_[i].handler(argc, argv);
+      return;
+    }
+  }
+  econsole_printf("%s: unknown command, try help\r\n", argv[0]);
+}
+
+/********************** external functions definition ************************/
+
+void econsole_init(const econsole_cmd_t* cmds, size_t count)
+{
+  cmds_ = cmds;
+  cmds_count_ = count;
+  line_len_ = 0;
+  line_overflow_ = false;
+}
+
+/**
+ * Consumes the received bytes and runs every complete line. Task context
+ * only: handlers print with econsole_printf(), which may wait for room.
+ */
+void econsole_poll(void)
+{
+  uint8_t byte;
+  while(0 < eboard_uart_read_byte(&byte))
+  {
+    if(('\r' == byte) || ('\n' == byte))
+    {
+      if(line_overflow_)
+      {
+        econsole_printf("line too long\r\n");
+      }
+      else
+      {
+        line_[line_len_] = '\0';
+        run_(line_);
+      }
+      line_len_ = 0;
+      line_overflow_ = false;
+    }
+    else if(line_len_ < (ECONSOLE_LINE_MAXLEN - 1))
+    {
+      line_[line_len_++] = (char)byte;
+    }
+    else
+    {
+      line_overflow_ = true;
+    }
+  }
+}
+
+/**
+ * Writes the text whole, waiting for room in the UART buffer so long dumps
+ * are paced instead of dropped. Log records are written whole too, the two
+ * never interleave inside a line. Longer text is cut, keeping the "\r\n" the
+ * format ends with.
+ */
+int econsole_printf(const char* fmt, ...)
+{
+  va_list args;
+  va_start(args, fmt);
+  int len = eformat_vsnprintf(out_, sizeof(out_), fmt, args);
+  va_end(args);
+  if(len < 0)
+  {
+    return len;
+  }
+  if((int)sizeof(out_) <= len)
+  {
+    len = sizeof(out_) - 1;
+    size_t fmt_len = strlen(fmt);
+    if((0 < fmt_len) && ('\n' == fmt[fmt_len - 1]))
+    {
+      out_[len - 2] = '\r';
+      out_[len - 1] = '\n';
+    }
+  }
+
+  while(true)
+  {
+    eboard_osal_port_critical_enter();
+    if((size_t)len <= eboard_uart_tx_free())
+    {
+      eboard_uart_write((const uint8_t*)out_, len);
+      eboard_osal_port_critical_exit();
+      return len;
+    }
+    eboard_osal_port_critical_exit();
+    eboard_osal_port_delay(1);
+  }
+}
+
+/********************** end of file ******************************************/
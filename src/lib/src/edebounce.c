@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : edebounce.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include "edebounce.h"
+
+/********************** macros and definitions *******************************/
+
+// edebounce_sample() counts 0, 1, 2, 3 and accepts on the wrap to 0
+_Static_assert(4 == EDEBOUNCE_SAMPLES, "edebounce_t holds a 2 bit counter per input");
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+void edebounce_init(edebounce_t *db, uint32_t initial)
+{
+  db->state = initial;
+  db->cnt0 = 0;
+  db->cnt1 = 0;
+}
+
+/*
+ * Returns the mask of inputs whose debounced state toggled with this sample.
+ */
+uint32_t edebounce_sample(edebounce_t *db, uint32_t sample)
+{
+  uint32_t delta = sample ^ db->state;
+  db->cnt1 = (db->cnt1 ^ db->cnt0) & delta;
+  db->cnt0 = ~db->cnt0 & delta;
+
+  uint32_t toggle = delta & ~(db->cnt0 | db->cnt1);
+  db->state ^= toggle;
+  return toggle;
+}
+
+uint32_t edebounce_state(const edebounce_t *db)
+{
+  return db->state;
+}
+
+/*
+ * Mask of inputs with a change in progress (still counting).
+ */
+uint32_t edebounce_pending(const edebounce_t *db)
+{
+  return db->cnt0 | db->cnt1;
+}
+
+/*
+ * True when no input has a change in progress, no more samples are needed
+ * until an input moves again.
+ */
+bool edebounce_is_settled(const edebounce_t *db)
+{
+  return (0 == edebounce_pending(db));
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : eformat.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <limits.h>
+#include <string.h>
+
+#include "eformat.h"
+
+/********************** macros and definitions *******************************/
+
+#define FLAG_LEFT_              (1u << 0)
+#define FLAG_ZERO_              (1u << 1)
+#define NUMBER_MAXLEN_          (3 * sizeof(unsigned long long) + 1)
+
+/********************** internal data declaration ****************************/
+
+typedef struct
+{
+  char *str;
+  size_t size;
+  size_t len;
+} eformat_out_t_;
+
+/********************** internal functions declaration ***********************/
+
+static void put_char_(eformat_out_t_ *out, char c);
+
+static void put_chars_(eformat_out_t_ *out, const char *chars, size_t count);
+
+static void put_padding_(eformat_out_t_ *out, char c, int count);
+
+static void put_field_(eformat_out_t_ *out, const char *buffer, int len, int width, unsigned flags);
+
+static char* format_number_(char *end, unsigned long long value, unsigned base, const char *digits, bool negative);
+
+/********************** internal data definition *****************************/
+
+static const char digits_lower_[] = "0123456789abcdef";
+static const char digits_upper_[] = "0123456789ABCDEF";
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void put_char_(eformat_out_t_ *out, char c)
+{
+  if(out->len + 1 < out->size)
+  {
+    out->str[out->len] = c;
+  }
+  out->len++;
+}
+
+// Bulk copy of what still fits, the length keeps counting the rest
+static void put_chars_(eformat_out_t_ *out, const char *chars, size_t count)
+{
+  if(out->len + 1 < out->size)
+  {
+    size_t room = out->size - 1 - out->len;
+    memcpy(out->str + out->len, chars, (count < room) ? count : room);
+  }
+  out->len += count;
+}
+
+static void put_padding_(eformat_out_t_ *out, char c, int count)
+{
+  for(; 0 < count; --count)
+  {
+    put_char_(out, c);
+  }
+}
+
+static void put_field_(eformat_out_t_ *out, const char *buffer, int len, int width, unsigned flags)
+{
+  int padding = width - len;
+  if(!(flags & FLAG_LEFT_))
+  {
+    // Zero padding goes after the sign, space padding before it
+    if((flags & FLAG_ZERO_) && (0 < len) && ('-' == buffer[0]))
+    {
+      put_char_(out, '-');
+      buffer++;
+      len--;
+      put_padding_(out, '0', padding);
+    }
+    else
+    {
+      put_padding_(out, (flags & FLAG_ZERO_) ? '0' : ' ', padding);
+    }
+  }
+
+  put_chars_(out, buffer, (size_t)len);
+
+  if(flags & FLAG_LEFT_)
+  {
+    put_padding_(out, ' ', padding);
+  }
+}
+
+// Writes the digits right aligned at the end of buffer, returns the first one.
+// Wide division is only used for the digits that do not fit a long.
+static char* format_number_(char *end, unsigned long long value, unsigned base, const char *digits, bool negative)
+{
+  char *p = end;
+  while(ULONG_MAX < value)
+  {
+    *--p = digits[value % base];
+    value /= base;
+  }
+
+  unsigned long low = (unsigned long)value;
+  do
+  {
+    *--p = digits[low % base];
+    low /= base;
+  } while(0 != low);
+
+  if(negative)
+  {
+    *--p = '-';
+  }
+  return p;
+}
+
+/********************** external functions definition ************************/
+
+int eformat_vsnprintf(char *str, size_t size, const char *fmt, va_list args)
+{
+  eformat_out_t_ out = {str: str, size: size, len: 0};
+  char number[NUMBER_MAXLEN_];
+  char *number_end = number + sizeof(number);
+
+  while('\0' != *fmt)
+  {
+    if('%' != *fmt)
+    {
+      const char *run = fmt;
+      while(('\0' != *fmt) && ('%' != *fmt))
+      {
+        fmt++;
+      }
+      put_chars_(&out, run, (size_t)(fmt - run));
+      continue;
+    }
+    const char *spec = fmt++;
+
+    unsigned flags = 0;
+    for(;; ++fmt)
+    {
+      if('-' == *fmt)
+      {
+        flags |= FLAG_LEFT_;
+      }
+      else if('0' == *fmt)
+      {
+        flags |= FLAG_ZERO_;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    int width = 0;
+    if('*' == *fmt)
+    {
+      width = va_arg(args, int);
+      if(width < 0)
+      {
+        flags |= FLAG_LEFT_;
+        width = -width;
+      }
+      fmt++;
+    }
+    else
+    {
+      while(('0' <= *fmt) && (*fmt <= '9'))
+      {
+        width = (width * 10) + (*fmt++ - '0');
+      }
+    }
+
+    if(flags & FLAG_LEFT_)
+    {
+      flags &= ~FLAG_ZERO_;
+    }
+
+    unsigned length = 0;
+    for(; ('l' == *fmt) && (length < 2); ++fmt)
+    {
+      length++;
+    }
+
+    switch(*fmt)
+    {
+      case 'd':
+      case 'i':
+      {
+        long long value = (2 == length) ? va_arg(args, long long) : (1 == length) ? va_arg(args, long) : va_arg(args, int);
+        unsigned long long magnitude = (value < 0) ? (0ull - (unsigned long long)value) : (unsigned long long)value;
+        char *p = format_number_(number_end, magnitude, 10, digits_lower_, value < 0);
+        put_field_(&out, p, number_end - p, width, flags);
+        break;
+      }
+      case 'u':
+      case 'x':
+      case 'X':
+      {
+        unsigned long long value = (2 == length) ? va_arg(args, unsigned long long) : (1 == length) ? va_arg(args, unsigned long) : va_arg(args, unsigned int);
+        unsigned base = ('u' == *fmt) ? 10 : 16;
+        const char *digits = ('X' == *fmt) ? digits_upper_ : digits_lower_;
+        char *p = format_number_(number_end, value, base, digits, false);
+        put_field_(&out, p, number_end - p, width, flags);
+        break;
+      }
+      case 's':
+      {
+        const char *s = va_arg(args, const char*);
+        if(NULL == s)
+        {
+          s = "(null)";
+        }
+        put_field_(&out, s, (int)strlen(s), width, flags & ~FLAG_ZERO_);
+        break;
+      }
+      case 'c':
+      {
+        char c = (char)va_arg(args, int);
+        put_field_(&out, &c, 1, width, flags & ~FLAG_ZERO_);
+        break;
+      }
+      case '%':
+        put_char_(&out, '%');
+        break;
+      default:
+        // Unsupported conversion, copied verbatim
+        while(spec != fmt)
+        {
+          put_char_(&out, *spec++);
+        }
+        if('\0' == *fmt)
+        {
+          continue;
+        }
+        put_char_(&out, *fmt);
+        break;
+    }
+    fmt++;
+  }
+
+  if(0 < size)
+  {
+    str[(out.len < size) ? out.len : (size - 1)] = '\0';
+  }
+  return (int)out.len;
+}
+
+int eformat_snprintf(char *str, size_t size, const char *fmt, ...)
+{
+  va_list args;
+  va_start(args, fmt);
+  int ret = eformat_vsnprintf(str, size, fmt, args);
+  va_end(args);
+  return ret;
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : ehsm.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "eboard.h"
+#include "ehsm.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static uint8_t parent_(const ehsm_def_t* def, uint8_t state);
+
+static uint8_t lca_(const ehsm_def_t* def, uint8_t a, uint8_t b);
+
+static void enter_(ehsm_t* hsm, uint8_t from, uint8_t target, const void* event);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint8_t parent_(const ehsm_def_t* def, uint8_t state)
+{
+  return def->states[state].parent;
+}
+
+// Least common ancestor, EHSM_NONE when the states share none
+static uint8_t lca_(const ehsm_def_t* def, uint8_t a, uint8_t b)
+{
+  uint8_t depth_a = 0;
+  uint8_t depth_b = 0;
+  for(uint8_t s = a; EHSM_NONE != s; s = parent_(def, s))
+  {
+    depth_a++;
+  }
+  for(uint8_t s = b; EHSM_NONE != s; s = parent_(def, s))
+  {
+    depth_b++;
+  }
+
+  for(; depth_b < depth_a; depth_a--)
+  {
+    a = parent_(def, a);
+  }
+  for(; depth_a < depth_b; depth_b--)
+  {
+    b = parent_(def, b);
+  }
+  while(a != b)
+  {
+    a = parent_(def, a);
+    b = parent_(def, b);
+  }
+  return a;
+}
+
+// Runs the entry actions from below "from" down to "target", outermost first
+static void enter_(ehsm_t* hsm, uint8_t from, uint8_t target, const void* event)
+{
+  const ehsm_def_t* def = hsm->def;
+  uint8_t path[EHSM_DEPTH_MAX];
+  size_t depth = 0;
+
+  for(uint8_t s = target; from != s; s = parent_(def, s))
+  {
+    // A table nested deeper than EHSM_DEPTH_MAX is a definition error
+    assert(depth < EHSM_DEPTH_MAX);
+    path[depth++] = s;
+  }
+
+  hsm->state = target;
+  while(0 < depth)
+  {
+    const ehsm_state_t* state = &def->states[path[--depth]];
+    if(NULL != state->entry)
+    {
+      state->entry(hsm, event);
+    }
+  }
+}
+
+/********************** external functions definition ************************/
+
+/**
+ * Enters the initial state, with the entry actions of its ancestors.
+ */
+void ehsm_init(ehsm_t* hsm, const ehsm_def_t* def, uint8_t id, uint8_t initial, void* ctx, ehsm_trace_t trace)
+{
+  hsm->def = def;
+  hsm->id = id;
+  hsm->state = EHSM_NONE;
+  hsm->ctx = ctx;
+  hsm->trace = trace;
+  enter_(hsm, EHSM_NONE, initial, NULL);
+}
+
+/**
+ * Looks the signal up in the table of the active state, then in the tables
+ * of its ancestors: at most EHSM_DEPTH_MAX lookups, whatever the size of
+ * the machine. A transition runs the exit actions up to the common ancestor
+ * with the target, the transition action and then the entry actions down to
+ * the target. Returns false if no state handled the signal.
+ */
+bool ehsm_dispatch(ehsm_t* hsm, uint8_t signal, const void* event)
+{
+  const ehsm_def_t* def = hsm->def;
+  const ehsm_transition_t* tran = NULL;
+  uint8_t source = hsm->state;
+
+  if(def->signal_cnt <= signal)
+  {
+    return false;
+  }
+
+  while(EHSM_NONE != source)
+  {
+    tran = &def->transitions[(source * def->signal_cnt) + signal];
+    if(tran->handled)
+    {
+      break;
+    }
+    source = parent_(def, source);
+  }
+
+  if(EHSM_NONE == source)
+  {
+    return false;
+  }
+
+  if(EHSM_NONE == tran->target)
+  {
+    if(NULL != tran->action)
+    {
+      tran->action(hsm, event);
+    }
+    return true;
+  }
+
+  uint8_t active = hsm->state;
+  uint8_t lca = (source == tran->target) ? parent_(def, source) : lca_(def, source, tran->target);
+
+  for(uint8_t s = active; lca != s; s = parent_(def, s))
+  {
+    if(NULL != def->states[s].exit)
+    {
+      def->states[s].exit(hsm, event);
+    }
+  }
+  if(NULL != tran->action)
+  {
+    tran->action(hsm, event);
+  }
+  enter_(hsm, lca, tran->target, event);
+
+  if(NULL != hsm->trace)
+  {
+    hsm->trace(hsm, active, tran->target, signal);
+  }
+  return true;
+}
+
+/**
+ * True if the state is the active one or one of its ancestors.
+ */
+bool ehsm_is_in(const ehsm_t* hsm, uint8_t state)
+{
+  for(uint8_t s = hsm->state; EHSM_NONE != s; s = parent_(hsm->def, s))
+  {
+    if(state == s)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Trace hook that keeps transitions in the log flight recorder, no UART
+ * cost: "hsm id:signal:source -> target", two hex digits each. Called
+ * directly, not through ELOG_TRACE, so it does not depend on the log
+ * configuration of the including file.
+ */
+void ehsm_trace_flight(const ehsm_t* hsm, uint8_t source, uint8_t target, uint8_t signal)
+{
+  eboard_log_trace("hsm %06lx -> %lu", ((uint32_t)hsm->id << 16) | ((uint32_t)signal << 8) | source, target);
+}
+
+/********************** end of file ******************************************/
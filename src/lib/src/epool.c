@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : epool.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "eboard.h"
+#include "epool.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+#ifdef DEBUG
+static bool owned_(epool_t* pool, void* block, size_t* pindex);
+#endif
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+#ifdef DEBUG
+static bool owned_(epool_t* pool, void* block, size_t* pindex)
+{
+  uintptr_t offset = (uintptr_t)block - (uintptr_t)pool->blocks;
+  if(((uint8_t*)block < pool->blocks) || ((pool->block_size * pool->count) <= offset) || (0 != (offset % pool->block_size)))
+  {
+    return false;
+  }
+  *pindex = offset / pool->block_size;
+  return true;
+}
+#endif
+
+/********************** external functions definition ************************/
+
+/**
+ * Constant time: pops the free list, or hands out the next never used block
+ * so the pool needs no init pass. Safe from tasks and interrupts. Returns
+ * NULL when the pool is exhausted.
+ */
+void* epool_alloc(epool_t* pool)
+{
+  void* block = NULL;
+  uint32_t state = eboard_osal_port_isr_lock();
+  if(NULL != pool->free_list)
+  {
+    block = pool->free_list;
+    pool->free_list = *(void**)block;
+  }
+  else if(pool->fresh < pool->count)
+  {
+    block = pool->blocks + (pool->fresh++ * pool->block_size);
+  }
+
+  if(NULL == block)
+  {
+    pool->stats.fails++;
+  }
+  else
+  {
+    pool->stats.in_use++;
+    if(pool->stats.peak < pool->stats.in_use)
+    {
+      pool->stats.peak = pool->stats.in_use;
+    }
+#ifdef DEBUG
+    if(NULL != pool->map)
+    {
+      size_t index = ((uint8_t*)block - pool->blocks) / pool->block_size;
+      pool->map[index / 32] |= (1u << (index % 32));
+    }
+#endif
+  }
+  eboard_osal_port_isr_unlock(state);
+  return block;
+}
+
+/**
+ * Constant time, safe from tasks and interrupts. DEBUG builds reject and
+ * count foreign pointers and double frees instead of corrupting the list,
+ * for the pools they define.
+ */
+void epool_free(epool_t* pool, void* block)
+{
+  if(NULL == block)
+  {
+    return;
+  }
+
+  uint32_t state = eboard_osal_port_isr_lock();
+#ifdef DEBUG
+  size_t index;
+  if(NULL != pool->map)
+  {
+    if(!owned_(pool, block, &index) || !(pool->map[index / 32] & (1u << (index % 32))))
+    {
+      pool->stats.bad_frees++;
+      eboard_osal_port_isr_unlock(state);
+      return;
+    }
+    pool->map[index / 32] &= ~(1u << (index % 32));
+  }
+#endif
+  *(void**)block = pool->free_list;
+  pool->free_list = block;
+  pool->stats.in_use--;
+  eboard_osal_port_isr_unlock(state);
+}
+
+void epool_stats(const epool_t* pool, epool_stats_t* stats)
+{
+  uint32_t state = eboard_osal_port_isr_lock();
+  *stats = pool->stats;
+  eboard_osal_port_isr_unlock(state);
+}
+
+/********************** end of file ******************************************/
@@ -40,6 +40,11 @@ size_t euart_write_buffer_len(euart_t *phandle)
   return eringbuffer_len(pTX_RB);
 }
 
+size_t euart_write_buffer_free(euart_t *phandle)
+{
+  return eringbuffer_free(pTX_RB);
+}
+
 size_t euart_write(euart_t *phandle, const uint8_t *buffer, size_t size)
 {
   size_t ret =  eringbuffer_write(pTX_RB, buffer, size);
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : bench_button_rate.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "replay.h"
+
+/********************** macros and definitions *******************************/
+
+#define WAVEFORM_MS             (60000)
+#define WAVEFORM_EDGES          (512)
+
+/*
+ * A minute of use of the SW input, 3 ms of chatter on every change:
+ * ten short presses, three long ones, one stuck for 9 s and then idle.
+ */
+#define WAVEFORM\
+    "b3 "\
+    "d100 u2000 d100 u2000 d100 u2000 d100 u2000 d100 u2000 "\
+    "d100 u2000 d100 u2000 d100 u2000 d100 u2000 d100 u2000 "\
+    "d3000 u2000 d3000 u2000 d3000 u2000 "\
+    "d9000 u13000"
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static replay_edge_t edges_[WAVEFORM_EDGES];
+static replay_result_t result_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+/*
+ * Queue messages per second from the button service on a simulated waveform,
+ * run through the classifier of the firmware (button.c, see replay_run()).
+ * Before, task_ButtonEvent sent an event to the led every DEBOUNCE_PERIOD loop,
+ * NONE included: that count follows from the loop period and is computed, not
+ * replayed. Now it publishes only the classified transitions.
+ */
+int main(void)
+{
+  size_t count = replay_synth(WAVEFORM, 3, 0, edges_, WAVEFORM_EDGES);
+  replay_run(edges_, count, &result_);
+
+  uint32_t before = WAVEFORM_MS / DEBOUNCE_PERIOD;
+  double seconds = WAVEFORM_MS / 1000.0;
+
+  printf("%zu edges over %.0f s\n", count, seconds);
+  printf("%-32s %8lu messages %8.2f msg/s %8lu wakes\n", "before, every loop (computed)", (unsigned long)before,
+         before / seconds, (unsigned long)before);
+  printf("%-32s %8zu messages %8.2f msg/s %8lu wakes\n", "after, on transitions", result_.count,
+         result_.count / seconds, (unsigned long)result_.steps);
+  replay_print(stdout, &result_);
+
+  return (0 < result_.count) && (result_.count < before) ? 0 : 1;
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : bench_eformat.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "eformat.h"
+#include "bench.h"
+
+/********************** macros and definitions *******************************/
+
+#define BENCH_COUNT             (200000)
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static char line_[88];
+static volatile int sink_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+/*
+ * eformat_snprintf() against the C library snprintf() on the lines the
+ * logger builds, into the ELOG_LINE_MAXLEN buffer.
+ */
+int main(void)
+{
+  uint64_t begin;
+
+  begin = bench_ns();
+  for(uint32_t i = 0; i < BENCH_COUNT; ++i)
+  {
+    sink_ += snprintf(line_, sizeof(line_), "[%llu] %s%s\r\n", (unsigned long long)i * 1000u, "button: SHORT", "");
+    sink_ += snprintf(line_, sizeof(line_), "button: debounce sampling overrun, %lu missed", (unsigned long)i);
+  }
+  BENCH_REPORT("snprintf, 2 log lines", bench_ns() - begin, BENCH_COUNT);
+
+  begin = bench_ns();
+  for(uint32_t i = 0; i < BENCH_COUNT; ++i)
+  {
+    sink_ += eformat_snprintf(line_, sizeof(line_), "[%llu] %s%s\r\n", (unsigned long long)i * 1000u, "button: SHORT", "");
+    sink_ += eformat_snprintf(line_, sizeof(line_), "button: debounce sampling overrun, %lu missed", (unsigned long)i);
+  }
+  BENCH_REPORT("eformat_snprintf, 2 log lines", bench_ns() - begin, BENCH_COUNT);
+
+  return 0;
+}
+
+/********************** end of file ******************************************/
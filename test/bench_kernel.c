@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : bench_kernel.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+
+#include "epool.h"
+#include "bench.h"
+
+/********************** macros and definitions *******************************/
+
+#define BENCH_BURSTS            (20000)
+#define BENCH_BURST_LEN         (12)    // A full led queue plus two, see task_button.c
+#define BENCH_FRAGMENTS         (96)
+
+/********************** internal data declaration ****************************/
+
+// Stands for ButtonEvent_t on the target: a 32-bit ao_event_t, idx, time, seq
+typedef struct
+{
+  uint8_t bytes[24];
+} bench_event_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+EPOOL_DEFINE(bench_pool, bench_event_t, BENCH_BURST_LEN);
+
+static void* burst_[BENCH_BURST_LEN];
+static uint64_t burst_ns_[BENCH_BURSTS];
+static void* fragments_[BENCH_FRAGMENTS];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static int compare_ns_(const void* a, const void* b)
+{
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+/*
+ * Burst of BENCH_BURST_LEN events taken and given back oldest first, as the
+ * led consumes them. Reports the mean and the 99th percentile burst per
+ * operation, the maximum on the host is the scheduler of the host.
+ */
+static void bench_alloc_(const char* name, void* (*alloc)(void), void (*release)(void*))
+{
+  uint64_t total = 0;
+
+  for(uint32_t burst = 0; burst < BENCH_BURSTS; ++burst)
+  {
+    uint64_t begin = bench_ns();
+    for(uint32_t i = 0; i < BENCH_BURST_LEN; ++i)
+    {
+      burst_[i] = alloc();
+    }
+    for(uint32_t i = 0; i < BENCH_BURST_LEN; ++i)
+    {
+      release(burst_[i]);
+    }
+    uint64_t ns = bench_ns() - begin;
+    total += ns;
+    burst_ns_[burst] = ns;
+  }
+  qsort(burst_ns_, BENCH_BURSTS, sizeof(burst_ns_[0]), compare_ns_);
+  BENCH_REPORT(name, total, (uint64_t)BENCH_BURSTS * 2 * BENCH_BURST_LEN);
+  printf("%-32s %10.1f ns/op p99\n", "", (double)burst_ns_[BENCH_BURSTS * 99 / 100] / (2 * BENCH_BURST_LEN));
+}
+
+static void* heap_alloc_(void)
+{
+  return pvPortMalloc(sizeof(bench_event_t));
+}
+
+static void heap_release_(void* block)
+{
+  vPortFree(block);
+}
+
+static void* pool_alloc_(void)
+{
+  return epool_alloc(&bench_pool);
+}
+
+static void pool_release_(void* block)
+{
+  epool_free(&bench_pool, block);
+}
+
+// Leaves every other small block allocated, the free list then holds holes
+// too small for an event in front of the large free block.
+static void heap_fragment_(void)
+{
+  srand(1);
+  for(uint32_t i = 0; i < BENCH_FRAGMENTS; ++i)
+  {
+    fragments_[i] = pvPortMalloc(4 + (size_t)(rand() % 12));
+  }
+  for(uint32_t i = 0; i < BENCH_FRAGMENTS; i += 2)
+  {
+    vPortFree(fragments_[i]);
+  }
+}
+
+/********************** external functions definition ************************/
+
+/*
+ * Kernel benchmarks on the host port, see freertos/portmacro.h: epool
+ * against heap_4 for the button event blocks. The send-to-wake figures are
+ * in bench_wake.c.
+ */
+int main(void)
+{
+  bench_alloc_("heap_4, event burst", heap_alloc_, heap_release_);
+  bench_alloc_("epool, event burst", pool_alloc_, pool_release_);
+  heap_fragment_();
+  bench_alloc_("heap_4 fragmented, event burst", heap_alloc_, heap_release_);
+  bench_alloc_("epool, event burst", pool_alloc_, pool_release_);
+
+
+  return 0;
+}
+
+/********************** end of file ******************************************/
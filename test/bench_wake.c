@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : bench_wake.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "bench.h"
+
+/********************** macros and definitions *******************************/
+
+#define BENCH_WAKES             (200000)
+
+#define RECEIVER_STACK          (256)
+#define RECEIVER_QUEUE_LEN      (10)
+#define RECEIVER_NOTIFY_QUEUE   (1u << 31) // As AO_NOTIFY_QUEUE, see ao.h
+
+/********************** internal data declaration ****************************/
+
+typedef enum
+{
+  RECEIVE_QUEUE,  // xQueueReceive() blocks
+  RECEIVE_NOTIFY, // xTaskNotifyWait() blocks, nothing else to take
+  RECEIVE_AO,     // xTaskNotifyWait() blocks, then the queue is drained
+} receive_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static StaticTask_t receiver_tcb_;
+static StackType_t receiver_stack_[RECEIVER_STACK];
+static TaskHandle_t receiver_;
+
+static StaticQueue_t queue_buffer_;
+static uint8_t queue_storage_[RECEIVER_QUEUE_LEN * sizeof(void*)];
+static QueueHandle_t queue_;
+
+static uint32_t event_;
+static volatile bool sent_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void receiver_task_(void* arguments)
+{
+  (void)arguments;
+}
+
+static void send_queue_(void)
+{
+  void* event = &event_;
+  xQueueSend(queue_, &event, 0);
+  sent_ = true;
+}
+
+static void send_queue_from_isr_(void)
+{
+  void* event = &event_;
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(queue_, &event, &woken);
+  sent_ = true;
+}
+
+static void send_notify_(void)
+{
+  xTaskNotify(receiver_, 1u << 0, eSetBits);
+  sent_ = true;
+}
+
+static void send_notify_from_isr_(void)
+{
+  BaseType_t woken = pdFALSE;
+  xTaskNotifyFromISR(receiver_, 1u << 0, eSetBits, &woken);
+  sent_ = true;
+}
+
+// ao_post(): the event goes through the queue, the notification wakes
+static void send_ao_(void)
+{
+  void* event = &event_;
+  xQueueSend(queue_, &event, 0);
+  xTaskNotify(receiver_, RECEIVER_NOTIFY_QUEUE, eSetBits);
+  sent_ = true;
+}
+
+/*
+ * The receiver blocks, the sender runs from the yield of the port and makes
+ * it ready, the receiver takes the event: the whole kernel path of a
+ * send-to-wake except the context switch itself, which every transport pays
+ * the same.
+ */
+static void bench_wake_(const char* name, void (*send)(void), receive_t receive)
+{
+  uint64_t begin = bench_ns();
+  uint32_t missed = 0;
+
+  for(uint32_t i = 0; i < BENCH_WAKES; ++i)
+  {
+    void* event = NULL;
+    uint32_t bits = 0;
+
+    sent_ = false;
+    host_port_on_yield(send);
+    switch(receive)
+    {
+      case RECEIVE_QUEUE:
+        xQueueReceive(queue_, &event, portMAX_DELAY);
+        missed += (&event_ != event);
+        break;
+      case RECEIVE_NOTIFY:
+        xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+        missed += (0 == bits);
+        break;
+      case RECEIVE_AO:
+        xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+        while(pdPASS == xQueueReceive(queue_, &event, 0))
+        {
+        }
+        missed += (0 == (bits & RECEIVER_NOTIFY_QUEUE)) || (&event_ != event);
+        break;
+    }
+    missed += !sent_;
+  }
+  BENCH_REPORT(name, bench_ns() - begin, BENCH_WAKES);
+  if(0 < missed)
+  {
+    printf("%s: %lu wakes did not go through the blocking path\n", name, (unsigned long)missed);
+  }
+}
+
+/********************** external functions definition ************************/
+
+/*
+ * Send-to-wake of a blocked receiver on the host port, see
+ * freertos/portmacro.h: the xQueueSend()/xQueueReceive() pair, a bare task
+ * notification, and the queue plus notification of ao_post().
+ */
+int main(void)
+{
+  receiver_ = xTaskCreateStatic(receiver_task_, "receiver", RECEIVER_STACK, NULL, tskIDLE_PRIORITY + 1,
+                                receiver_stack_, &receiver_tcb_);
+  queue_ = xQueueCreateStatic(RECEIVER_QUEUE_LEN, sizeof(void*), queue_storage_, &queue_buffer_);
+
+  bench_wake_("queue send to wake", send_queue_, RECEIVE_QUEUE);
+  bench_wake_("notify send to wake", send_notify_, RECEIVE_NOTIFY);
+  bench_wake_("ao_post send to wake", send_ao_, RECEIVE_AO);
+  bench_wake_("queue send to wake, from isr", send_queue_from_isr_, RECEIVE_QUEUE);
+  bench_wake_("notify send to wake, from isr", send_notify_from_isr_, RECEIVE_NOTIFY);
+
+  return 0;
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,37 @@
+/*
+ * Host configuration of the FreeRTOS kernel for the benchmarks, on the
+ * single threaded port in portmacro.h. The kernel options follow
+ * Core/Inc/FreeRTOSConfig.h, except dynamic allocation: heap_4 is built
+ * here to be measured against epool.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+#include <stdint.h>
+
+#define configUSE_PREEMPTION                     1
+#define configSUPPORT_STATIC_ALLOCATION          1
+#define configSUPPORT_DYNAMIC_ALLOCATION         1
+#define configUSE_IDLE_HOOK                      0
+#define configUSE_TICK_HOOK                      0
+#define configTICK_RATE_HZ                       ((TickType_t)1000)
+#define configMAX_PRIORITIES                     ( 7 )
+#define configMINIMAL_STACK_SIZE                 ((uint16_t)128)
+#define configTOTAL_HEAP_SIZE                    ((size_t)(16 * 1024))
+#define configMAX_TASK_NAME_LEN                  ( 16 )
+#define configUSE_16_BIT_TICKS                   0
+#define configUSE_MUTEXES                        1
+#define configQUEUE_REGISTRY_SIZE                0
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION  0
+#define configUSE_TASK_NOTIFICATIONS             1
+#define configUSE_TIMERS                         0
+#define configUSE_CO_ROUTINES                    0
+
+#define INCLUDE_vTaskSuspend                     1
+#define INCLUDE_xTaskGetSchedulerState           1
+
+#define configASSERT(x)                          assert(x)
+
+#endif /* FREERTOS_CONFIG_H */
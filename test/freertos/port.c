@@ -0,0 +1,52 @@
+/*
+ * Single threaded host port, see portmacro.h.
+ */
+
+#include <stddef.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+static void (*yield_hook_)(void);
+
+void host_port_on_yield(void (*hook)(void))
+{
+  yield_hook_ = hook;
+}
+
+void host_port_yield(void)
+{
+  void (*hook)(void) = yield_hook_;
+  yield_hook_ = NULL;
+  if(NULL != hook)
+  {
+    hook();
+  }
+}
+
+StackType_t* pxPortInitialiseStack(StackType_t* pxTopOfStack, TaskFunction_t pxCode, void* pvParameters)
+{
+  (void)pxCode;
+  (void)pvParameters;
+  return pxTopOfStack;
+}
+
+BaseType_t xPortStartScheduler(void)
+{
+  return pdFALSE;
+}
+
+void vPortEndScheduler(void)
+{
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer,
+                                   uint32_t* pulIdleTaskStackSize)
+{
+  static StaticTask_t idle_tcb;
+  static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+
+  *ppxIdleTaskTCBBuffer = &idle_tcb;
+  *ppxIdleTaskStackBuffer = idle_stack;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
@@ -0,0 +1,54 @@
+/*
+ * Single threaded host port, only for the benchmarks. The scheduler is never
+ * started: critical sections do nothing and a yield runs the hook set by
+ * host_port_on_yield() once, standing for whatever the other tasks or the
+ * interrupts do while the calling task is blocked.
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+#define portCHAR                char
+#define portFLOAT               float
+#define portDOUBLE              double
+#define portLONG                long
+#define portSHORT               short
+#define portSTACK_TYPE          uintptr_t
+#define portBASE_TYPE           long
+#define portPOINTER_SIZE_TYPE   uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+#define portTICK_TYPE_IS_ATOMIC 1
+
+#define portSTACK_GROWTH        (-1)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT      8
+
+void host_port_yield(void);
+
+#define portYIELD()                             host_port_yield()
+#define portYIELD_FROM_ISR(x)                   do { if(x) { portYIELD(); } } while(0)
+#define portEND_SWITCHING_ISR(x)                portYIELD_FROM_ISR(x)
+
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portSET_INTERRUPT_MASK_FROM_ISR()       0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)    ((void)(x))
+
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters) void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters)       void vFunction(void *pvParameters)
+
+#define portNOP()
+
+void host_port_on_yield(void (*hook)(void));
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : eboard_host_port.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "eboard.h"
+#include "euart.h"
+#include "eboard_port.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static uint32_t critical_nesting_ = 0;
+
+static int uart_;
+static char uart_out_[4096];
+static size_t uart_out_len_;
+static bool uart_tx_busy_;
+
+/********************** external data definition *****************************/
+
+driver_gpio_descriptor_t_ driver_gpios_[EBOARD_GPIO__CNT];
+
+void* const p_huart_selected_ = &uart_;
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+// Single threaded host: the locks only check that they are balanced.
+void eboard_osal_port_critical_enter(void)
+{
+  critical_nesting_++;
+}
+
+void eboard_osal_port_critical_exit(void)
+{
+  critical_nesting_--;
+}
+
+uint32_t eboard_osal_port_isr_lock(void)
+{
+  return critical_nesting_++;
+}
+
+void eboard_osal_port_isr_unlock(uint32_t state)
+{
+  critical_nesting_ = state;
+}
+
+bool eboard_host_port_unlocked(void)
+{
+  return (0 == critical_nesting_);
+}
+
+uint32_t eboard_osal_port_get_time(void)
+{
+  return (uint32_t)eboard_time_ms();
+}
+
+void eboard_osal_port_delay(uint32_t time_ms)
+{
+  eboard_time_sim_advance((uint64_t)time_ms * 1000);
+}
+
+void eboard_osal_port_delay_until(uint32_t* pwake_time, uint32_t period)
+{
+  *pwake_time += period;
+  int32_t left = (int32_t)(*pwake_time - eboard_osal_port_get_time());
+  if(0 < left)
+  {
+    eboard_time_sim_advance((uint64_t)left * 1000);
+  }
+}
+
+// Every pointer is "ROM": the format strings of the log records are
+// literals, and the host has no flash range to check them against.
+bool eboard_hal_port_is_rom(const void* ptr)
+{
+  return (NULL != ptr);
+}
+
+void eboard_hal_port_image_layout(uint32_t layout[EBOARD_IMAGE_LAYOUT_WORDS])
+{
+  memset(layout, 0, EBOARD_IMAGE_LAYOUT_WORDS * sizeof(layout[0]));
+}
+
+void eboard_hal_port_gpio_write(void* handle, bool value)
+{
+  ((driver_gpio_descriptor_t_*)handle)->level = value;
+}
+
+bool eboard_hal_port_gpio_read(void* handle)
+{
+  return ((driver_gpio_descriptor_t_*)handle)->level;
+}
+
+void euart_hal_receive(void* phardware_handle, uint8_t* pbuffer, size_t size)
+{
+}
+
+// The bytes are captured as sent, the transfer completes when the test
+// takes them, see eboard_host_port_uart_take().
+void euart_hal_send(void* phardware_handle, uint8_t* pbuffer, size_t size)
+{
+  size_t room = sizeof(uart_out_) - 1 - uart_out_len_;
+  size_t len = (size < room) ? size : room;
+  memcpy(uart_out_ + uart_out_len_, pbuffer, len);
+  uart_out_len_ += len;
+  uart_tx_busy_ = true;
+}
+
+/*
+ * Completes every pending UART transfer, copies what was sent since the
+ * previous call in buffer (NUL terminated, cut to size) and forgets it.
+ */
+size_t eboard_host_port_uart_take(char* buffer, size_t size)
+{
+  while(uart_tx_busy_)
+  {
+    uart_tx_busy_ = false;
+    eboard_hal_port_uart_tx_irq(p_huart_selected_);
+  }
+
+  size_t len = (uart_out_len_ < size) ? uart_out_len_ : (size - 1);
+  memcpy(buffer, uart_out_, len);
+  buffer[len] = '\0';
+  uart_out_len_ = 0;
+  return len;
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : replay.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "driver.h"
+#include "button.h"
+#include "replay.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+static void replay_emit_(eboard_gpio_idx_t idx, EventType_t type, ButtonTime_t time);
+
+/********************** internal data definition *****************************/
+
+static const char* const event_names_[EVENT_TYPE__CNT] =
+{
+  [NONE] = "NONE",
+  [SHORT] = "SHORT",
+  [LONG] = "LONG",
+  [STUCK] = "STUCK",
+  [DOUBLE] = "DOUBLE",
+  [TRIPLE] = "TRIPLE",
+  [REPEAT] = "REPEAT",
+  [CHORD] = "CHORD",
+};
+
+static Button_t buttons_[REPLAY_INPUTS];
+static ButtonService_t service_;
+static replay_result_t* result_;
+static uint64_t now_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint64_t replay_ns_(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+static void replay_emit_(eboard_gpio_idx_t idx, EventType_t type, ButtonTime_t time)
+{
+  if(REPLAY_EVENTS_MAX <= result_->count)
+  {
+    result_->lost++;
+    return;
+  }
+  replay_event_t* event = &result_->events[result_->count++];
+  event->time = now_;
+  event->source = time;
+  event->idx = idx;
+  event->type = type;
+}
+
+/********************** external functions definition ************************/
+
+const char* replay_event_name(EventType_t type)
+{
+  return (type < EVENT_TYPE__CNT) ? event_names_[type] : "?";
+}
+
+/*
+ * One line of "rec dump": "time delta input level". The time field wraps,
+ * so times are rebuilt from the deltas; *prev is UINT64_MAX before the first
+ * edge. Headers, comments and blank lines return false.
+ */
+bool replay_parse_line(const char* line, replay_edge_t* edge, uint64_t* prev)
+{
+  unsigned long time;
+  unsigned long delta;
+  unsigned int idx;
+  unsigned int level;
+
+  if(('#' == line[0]) || (4 != sscanf(line, "%lu %lu %u %u", &time, &delta, &idx, &level)) || (REPLAY_INPUTS <= idx))
+  {
+    return false;
+  }
+  edge->time = (UINT64_MAX == *prev) ? time : (*prev + delta);
+  edge->idx = (uint8_t)idx;
+  edge->level = (0 != level);
+  *prev = edge->time;
+  return true;
+}
+
+size_t replay_load(FILE* file, replay_edge_t* edges, size_t max)
+{
+  char line[128];
+  uint64_t prev = UINT64_MAX;
+  size_t count = 0;
+
+  while((count < max) && (NULL != fgets(line, sizeof(line), file)))
+  {
+    if(replay_parse_line(line, &edges[count], &prev))
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+/*
+ * Synthetic waveform of one input, from a list of space separated steps:
+ *  d<ms>  pressed for ms
+ *  u<ms>  released for ms
+ *  b<n>   the following level changes chatter n times, 1 ms per bounce
+ * The input starts released at start.
+ */
+size_t replay_synth(const char* spec, uint8_t idx, uint64_t start, replay_edge_t* edges, size_t max)
+{
+  uint64_t time = start;
+  bool level = false;
+  unsigned long bounces = 0;
+  size_t count = 0;
+
+  while('\0' != *spec)
+  {
+    char op = *spec++;
+    char* end;
+    unsigned long value = strtoul(spec, &end, 10);
+    spec = end;
+    while(' ' == *spec)
+    {
+      spec++;
+    }
+
+    if('b' == op)
+    {
+      bounces = value;
+      continue;
+    }
+    if(('d' != op) && ('u' != op))
+    {
+      break;
+    }
+
+    bool next = ('d' == op);
+    if(next != level)
+    {
+      for(unsigned long i = 0; i <= bounces; ++i)
+      {
+        if(count < max)
+        {
+          edges[count++] = (replay_edge_t){time: time + (2 * i), idx: idx, level: next};
+        }
+        if((i < bounces) && (count < max))
+        {
+          edges[count++] = (replay_edge_t){time: time + (2 * i) + 1, idx: idx, level: level};
+        }
+      }
+      level = next;
+    }
+    time += value;
+  }
+  return count;
+}
+
+// Adds other to edges, keeping them sorted by time.
+size_t replay_merge(replay_edge_t* edges, size_t count, const replay_edge_t* other, size_t other_count, size_t max)
+{
+  for(size_t i = 0; (i < other_count) && (count < max); ++i)
+  {
+    size_t j = count++;
+    while((0 < j) && (other[i].time < edges[j - 1].time))
+    {
+      edges[j] = edges[j - 1];
+      j--;
+    }
+    edges[j] = other[i];
+  }
+  return count;
+}
+
+/*
+ * Runs the edges through the classifier of the button service (button.c),
+ * one step per ms of simulated time, fed as task_ButtonEvent does: the
+ * edges start the sampling, the inputs are debounced every DEBOUNCE_PERIOD
+ * and the gesture deadlines are served once due. The firmware delivers DMA
+ * sampled edges one block late, that delay is not part of the classifier
+ * and is left out here.
+ */
+void replay_run(const replay_edge_t* edges, size_t count, replay_result_t* result)
+{
+  uint32_t levels = 0;
+  size_t button_cnt = 0;
+  uint64_t next_sample = 0;
+  size_t next_edge = 0;
+
+  memset(result, 0, sizeof(*result));
+  result_ = result;
+  if(0 == count)
+  {
+    return;
+  }
+
+  // One button per input found in the edges
+  uint32_t inputs = 0;
+  for(size_t i = 0; i < count; ++i)
+  {
+    inputs |= (1u << edges[i].idx);
+  }
+  for(uint8_t idx = 0; idx < REPLAY_INPUTS; ++idx)
+  {
+    if(inputs & (1u << idx))
+    {
+      buttons_[button_cnt++] = (Button_t){.idx = (eboard_gpio_idx_t)idx, .on_event = replay_emit_};
+    }
+  }
+  ButtonServiceInit(&service_, buttons_, button_cnt, 0, edges[0].time);
+
+  uint64_t last = edges[count - 1].time;
+  for(now_ = edges[0].time; now_ <= (last + REPLAY_IDLE_MAX); ++now_)
+  {
+    ButtonTime_t deadline;
+    bool sampling = ButtonServiceIsSampling(&service_);
+    bool edge_due = (next_edge < count) && (edges[next_edge].time <= now_);
+    bool sample_due = sampling && (next_sample <= now_);
+    bool timer_due = ButtonServiceDeadline(&service_, &deadline) && (deadline <= now_);
+    if(!edge_due && !sample_due && !timer_due)
+    {
+      if((count <= next_edge) && !sampling && !ButtonServiceDeadline(&service_, &deadline))
+      {
+        break;
+      }
+      continue;
+    }
+
+    eboard_time_sim_set(now_ * 1000);
+    uint64_t begin = replay_ns_();
+
+    for(; (next_edge < count) && (edges[next_edge].time <= now_); ++next_edge)
+    {
+      const replay_edge_t* edge = &edges[next_edge];
+      levels = edge->level ? (levels | (1u << edge->idx)) : (levels & ~(1u << edge->idx));
+      if(ButtonServiceEdge(&service_, (eboard_gpio_idx_t)edge->idx, edge->time))
+      {
+        next_sample = now_;
+      }
+    }
+
+    if(ButtonServiceIsSampling(&service_) && (next_sample <= now_))
+    {
+      next_sample += DEBOUNCE_PERIOD;
+      ButtonServiceSample(&service_, levels, now_);
+    }
+
+    ButtonServiceTimeout(&service_, now_);
+
+    uint64_t ns = replay_ns_() - begin;
+    result->steps++;
+    result->ns += ns;
+    if(result->ns_max < ns)
+    {
+      result->ns_max = ns;
+    }
+  }
+}
+
+void replay_print(FILE* file, const replay_result_t* result)
+{
+  for(size_t i = 0; i < result->count; ++i)
+  {
+    const replay_event_t* event = &result->events[i];
+    fprintf(file, "%llu %u %s source %llu latency %llu\n", (unsigned long long)event->time, event->idx,
+            replay_event_name(event->type), (unsigned long long)event->source,
+            (unsigned long long)(event->time - event->source));
+  }
+  fprintf(file, "events %zu, lost %zu, steps %u, host ns %llu (%llu per event, max step %llu)\n", result->count,
+          result->lost, result->steps, (unsigned long long)result->ns,
+          (unsigned long long)((0 < result->count) ? (result->ns / result->count) : 0),
+          (unsigned long long)result->ns_max);
+}
+
+/********************** end of file ******************************************/
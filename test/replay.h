@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file   : replay.h
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+#ifndef TEST_REPLAY_H_
+#define TEST_REPLAY_H_
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "app.h"
+
+/********************** macros ***********************************************/
+
+#define REPLAY_INPUTS           (8)    // The rec dump input field is 3 bits
+#define REPLAY_EVENTS_MAX       (256)
+#define REPLAY_IDLE_MAX         (20000) // ms run after the last edge at most
+
+/********************** typedef **********************************************/
+
+// One raw edge, as recorded by "rec" before any debouncing
+typedef struct
+{
+  uint64_t time;
+  uint8_t idx;
+  bool level;
+} replay_edge_t;
+
+typedef struct
+{
+  uint64_t time;   // When the classifier emitted it
+  uint64_t source; // ButtonEvent_t.time
+  uint8_t idx;
+  EventType_t type;
+} replay_event_t;
+
+typedef struct
+{
+  replay_event_t events[REPLAY_EVENTS_MAX];
+  size_t count;
+  size_t lost;     // Events past REPLAY_EVENTS_MAX
+  uint32_t steps;  // ms steps with classifier work: an edge, a sample or a timer
+  uint64_t ns;     // Host time spent in those steps
+  uint64_t ns_max;
+} replay_result_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+const char* replay_event_name(EventType_t type);
+
+bool replay_parse_line(const char* line, replay_edge_t* edge, uint64_t* prev);
+
+size_t replay_load(FILE* file, replay_edge_t* edges, size_t max);
+
+size_t replay_synth(const char* spec, uint8_t idx, uint64_t start, replay_edge_t* edges, size_t max);
+
+size_t replay_merge(replay_edge_t* edges, size_t count, const replay_edge_t* other, size_t other_count, size_t max);
+
+void replay_run(const replay_edge_t* edges, size_t count, replay_result_t* result);
+
+void replay_print(FILE* file, const replay_result_t* result);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEST_REPLAY_H_ */
+/********************** end of file ******************************************/
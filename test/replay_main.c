@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : replay_main.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "replay.h"
+
+/********************** macros and definitions *******************************/
+
+#define REPLAY_EDGES_MAX        (4096)
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static replay_edge_t edges_[REPLAY_EDGES_MAX];
+static replay_result_t result_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+/*
+ * Replays a waveform through the button classifier and prints the events
+ * with their cost:
+ *  replay <file>                    a "rec dump" capture, "-" for stdin
+ *  replay -s "<steps>" [idx [...]]  synthetic waveforms, see replay_synth()
+ * Every synthetic waveform drives its own input, from input 3 (SW) down.
+ */
+int main(int argc, char* argv[])
+{
+  size_t count = 0;
+
+  if((3 <= argc) && (0 == strcmp(argv[1], "-s")))
+  {
+    uint8_t idx = EBOARD_GPIO_SW;
+    for(int i = 2; i < argc; ++i, --idx)
+    {
+      static replay_edge_t synth[REPLAY_EDGES_MAX];
+      size_t synth_count = replay_synth(argv[i], idx, 0, synth, REPLAY_EDGES_MAX);
+      count = replay_merge(edges_, count, synth, synth_count, REPLAY_EDGES_MAX);
+    }
+  }
+  else if(2 == argc)
+  {
+    FILE* file = (0 == strcmp(argv[1], "-")) ? stdin : fopen(argv[1], "r");
+    if(NULL == file)
+    {
+      fprintf(stderr, "replay: cannot open %s\n", argv[1]);
+      return 2;
+    }
+    count = replay_load(file, edges_, REPLAY_EDGES_MAX);
+    if(stdin != file)
+    {
+      fclose(file);
+    }
+  }
+  else
+  {
+    fprintf(stderr, "usage: replay <rec dump file> | replay -s \"<steps>\" [...]\n");
+    return 2;
+  }
+
+  printf("edges %zu\n", count);
+  replay_run(edges_, count, &result_);
+  replay_print(stdout, &result_);
+  return 0;
+}
+
+/********************** end of file ******************************************/
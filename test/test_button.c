@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_button.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "button.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define WAVEFORM_MS             (4000)
+#define EVENTS_MAX              (8)
+
+/********************** internal data declaration ****************************/
+
+typedef struct
+{
+  EventType_t type;
+  ButtonTime_t time;
+} test_event_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static Button_t buttons_[] =
+{
+  {.idx = EBOARD_GPIO_SW},
+};
+static ButtonService_t service_;
+static uint32_t levels_[WAVEFORM_MS];
+static test_event_t events_[EVENTS_MAX];
+static size_t event_cnt_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void on_event_(eboard_gpio_idx_t idx, EventType_t type, ButtonTime_t time)
+{
+  if(event_cnt_ < EVENTS_MAX)
+  {
+    events_[event_cnt_].type = type;
+    events_[event_cnt_].time = time;
+  }
+  event_cnt_++;
+}
+
+// Pressed from begin to end, with 3 ms of chatter after each change
+static void press_(ButtonTime_t begin, ButtonTime_t end)
+{
+  for(ButtonTime_t t = begin; t < end; ++t)
+  {
+    levels_[t] = 1u << EBOARD_GPIO_SW;
+  }
+  levels_[begin + 1] = 0;
+  levels_[end + 1] = 1u << EBOARD_GPIO_SW;
+}
+
+// Fed as the DMA blocks of task_ButtonEvent, counts the blocks it needed
+static uint32_t run_(void)
+{
+  uint32_t busy = 0;
+
+  event_cnt_ = 0;
+  buttons_[0].on_event = on_event_;
+  ButtonServiceInit(&service_, buttons_, 1, 0, 0);
+  for(size_t t = 0; t < WAVEFORM_MS; t += EBOARD_GPIO_SAMPLE_BLOCK)
+  {
+    ButtonServiceSamples(&service_, levels_ + t, EBOARD_GPIO_SAMPLE_BLOCK, t + EBOARD_GPIO_SAMPLE_BLOCK - 1);
+    busy += ButtonServiceIsSampling(&service_);
+  }
+  return busy;
+}
+
+/********************** external functions definition ************************/
+
+int main(void)
+{
+  // Idle inputs need no sample at all
+  TEST_CHECK(0 == run_());
+  TEST_CHECK(0 == event_cnt_);
+
+  // A short press, dated with the first edge of its release: the chatter
+  // after each change is filtered
+  press_(100, 250);
+  uint32_t busy = run_();
+  TEST_CHECK(1 == event_cnt_);
+  TEST_CHECK(SHORT == events_[0].type);
+  TEST_CHECK(250 == events_[0].time);
+  TEST_CHECK(!ButtonServiceIsSampling(&service_));
+
+  // Only the blocks around the two changes were counted by the debouncer
+  TEST_CHECK((0 < busy) && (busy <= 4));
+
+  // A long press, in the same run as the short one
+  press_(1000, 1000 + LONG_TIME + 500);
+  run_();
+  TEST_CHECK(2 <= event_cnt_);
+  TEST_CHECK(SHORT == events_[0].type);
+  TEST_CHECK(LONG == events_[event_cnt_ - 1].type);
+  TEST_CHECK((1000 + LONG_TIME + 500) == events_[event_cnt_ - 1].time);
+
+  // Every threshold rule of the "thr" command
+  GestureThresholds_t th;
+  GestureThresholdsGet(&th);
+  const GestureThresholds_t good = th;
+  TEST_CHECK(GestureThresholdsSet(&good));
+  uint32_t* fields[] = {&th.short_time, &th.long_time, &th.stuck_time, &th.click_gap_time, &th.repeat_time,
+                        &th.chord_time};
+  for(size_t i = 0; i < (sizeof(fields) / sizeof(fields[0])); ++i)
+  {
+    th = good;
+    *fields[i] = 0;
+    TEST_CHECK(!GestureThresholdsSet(&th));
+  }
+  th = good;
+  th.long_time = th.short_time;
+  TEST_CHECK(!GestureThresholdsSet(&th));
+  th = good;
+  th.stuck_time = th.long_time;
+  TEST_CHECK(!GestureThresholdsSet(&th));
+  th = good;
+  th.click_gap_time = th.long_time;
+  TEST_CHECK(!GestureThresholdsSet(&th));
+  th = good;
+  th.chord_time = th.long_time;
+  TEST_CHECK(!GestureThresholdsSet(&th));
+  GestureThresholdsGet(&th);
+  TEST_CHECK(0 == memcmp(&th, &good, sizeof(th)));
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
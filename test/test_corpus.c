@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_corpus.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "replay.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define CORPUS_EDGES_MAX        (1024)
+#define CORPUS_EXPECT_MAX       (32)
+
+/********************** internal data declaration ****************************/
+
+typedef struct
+{
+  uint8_t idx;
+  EventType_t type;
+  uint32_t min_latency; // ms from the source edge, for the delayed events
+} corpus_expect_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static replay_edge_t edges_[CORPUS_EDGES_MAX];
+static corpus_expect_t expect_[CORPUS_EXPECT_MAX];
+static replay_result_t result_;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+/*
+ * "# expect: <input> <EVENT> [<min latency>]", one line per event, in the
+ * order they are emitted.
+ */
+static bool corpus_parse_expect_(const char* line, corpus_expect_t* expect)
+{
+  unsigned int idx;
+  char name[16];
+  unsigned long min_latency = 0;
+
+  if(2 > sscanf(line, "# expect: %u %15s %lu", &idx, name, &min_latency))
+  {
+    return false;
+  }
+  for(EventType_t type = 0; type < EVENT_TYPE__CNT; ++type)
+  {
+    if(0 == strcmp(name, replay_event_name(type)))
+    {
+      expect->idx = (uint8_t)idx;
+      expect->type = type;
+      expect->min_latency = (uint32_t)min_latency;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool corpus_run_(const char* path)
+{
+  char line[128];
+  uint64_t prev = UINT64_MAX;
+  size_t edge_count = 0;
+  size_t expect_count = 0;
+  bool pass = true;
+
+  FILE* file = fopen(path, "r");
+  if(NULL == file)
+  {
+    printf("%s: cannot open\n", path);
+    return false;
+  }
+  while(NULL != fgets(line, sizeof(line), file))
+  {
+    if((expect_count < CORPUS_EXPECT_MAX) && corpus_parse_expect_(line, &expect_[expect_count]))
+    {
+      expect_count++;
+    }
+    else if((edge_count < CORPUS_EDGES_MAX) && replay_parse_line(line, &edges_[edge_count], &prev))
+    {
+      edge_count++;
+    }
+  }
+  fclose(file);
+
+  replay_run(edges_, edge_count, &result_);
+
+  if(result_.count != expect_count)
+  {
+    printf("%s: %zu events, %zu expected\n", path, result_.count, expect_count);
+    pass = false;
+  }
+  for(size_t i = 0; (i < result_.count) && (i < expect_count); ++i)
+  {
+    const replay_event_t* event = &result_.events[i];
+    const corpus_expect_t* expect = &expect_[i];
+    if((event->idx != expect->idx) || (event->type != expect->type))
+    {
+      printf("%s: event %zu is %u %s, expected %u %s\n", path, i, event->idx, replay_event_name(event->type),
+             expect->idx, replay_event_name(expect->type));
+      pass = false;
+    }
+    else if((event->time - event->source) < expect->min_latency)
+    {
+      printf("%s: event %zu %s after %llu ms, expected at least %lu\n", path, i, replay_event_name(event->type),
+             (unsigned long long)(event->time - event->source), (unsigned long)expect->min_latency);
+      pass = false;
+    }
+  }
+  if(!pass)
+  {
+    replay_print(stdout, &result_);
+  }
+  return pass;
+}
+
+/********************** external functions definition ************************/
+
+/*
+ * Replays every corpus file given and checks the events against its
+ * "# expect:" lines.
+ */
+int main(int argc, char* argv[])
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    TEST_CHECK(corpus_run_(argv[i]));
+  }
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_econsole.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "eboard.h"
+#include "econsole.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define LONG_TEXT \
+    "0123456789012345678901234567890123456789012345678901234567890123456789" \
+    "0123456789012345678901234567890123456789"
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static char out_[256];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+int main(void)
+{
+  eboard_init();
+  eboard_host_port_uart_take(out_, sizeof(out_));
+
+  // Fits: written as is
+  TEST_CHECK(8 == econsole_printf("ok: %d\r\n", 42));
+  eboard_host_port_uart_take(out_, sizeof(out_));
+  TEST_CHECK(0 == strcmp(out_, "ok: 42\r\n"));
+
+  // Too long: cut to the buffer, the line still ends
+  int len = econsole_printf("%s\r\n", LONG_TEXT);
+  size_t taken = eboard_host_port_uart_take(out_, sizeof(out_));
+  TEST_CHECK((size_t)len == taken);
+  TEST_CHECK(sizeof(LONG_TEXT) > taken);
+  TEST_CHECK(0 == strncmp(out_, LONG_TEXT, taken - 2));
+  TEST_CHECK(0 == strcmp(out_ + taken - 2, "\r\n"));
+
+  // A partial line is cut without one
+  len = econsole_printf("%s", LONG_TEXT);
+  taken = eboard_host_port_uart_take(out_, sizeof(out_));
+  TEST_CHECK((size_t)len == taken);
+  TEST_CHECK(0 == strncmp(out_, LONG_TEXT, taken));
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
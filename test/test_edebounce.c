@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_edebounce.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "edebounce.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+int main(void)
+{
+  edebounce_t db;
+
+  // Input 0 changes after exactly EDEBOUNCE_SAMPLES differing samples
+  edebounce_init(&db, 0);
+  for(int i = 1; i < EDEBOUNCE_SAMPLES; ++i)
+  {
+    TEST_CHECK(0 == edebounce_sample(&db, 1u << 0));
+    TEST_CHECK(!edebounce_is_settled(&db));
+  }
+  TEST_CHECK((1u << 0) == edebounce_sample(&db, 1u << 0));
+  TEST_CHECK((1u << 0) == edebounce_state(&db));
+  TEST_CHECK(edebounce_is_settled(&db));
+
+  // A sample that agrees restarts the count
+  for(int i = 1; i < EDEBOUNCE_SAMPLES; ++i)
+  {
+    TEST_CHECK(0 == edebounce_sample(&db, 0));
+  }
+  TEST_CHECK(0 == edebounce_sample(&db, 1u << 0));
+  TEST_CHECK(edebounce_is_settled(&db));
+  for(int i = 1; i < EDEBOUNCE_SAMPLES; ++i)
+  {
+    TEST_CHECK(0 == edebounce_sample(&db, 0));
+  }
+  TEST_CHECK((1u << 0) == edebounce_sample(&db, 0));
+  TEST_CHECK(0 == edebounce_state(&db));
+
+  // Inputs are counted on their own
+  edebounce_init(&db, 1u << 31);
+  TEST_CHECK(0 == edebounce_sample(&db, (1u << 31) | (1u << 5)));
+  TEST_CHECK(0 == edebounce_sample(&db, 0));
+  for(int i = 2; i < EDEBOUNCE_SAMPLES; ++i)
+  {
+    TEST_CHECK(0 == edebounce_sample(&db, 1u << 5));
+  }
+  TEST_CHECK((1u << 31) == edebounce_sample(&db, 1u << 5));
+  TEST_CHECK(0 == edebounce_state(&db));
+  TEST_CHECK((1u << 5) == edebounce_pending(&db));
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_eformat.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+
+#include "eformat.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define FORMAT_SIZE_MAX         (64)
+
+// Formats with both, for every buffer size, and compares output and return.
+#define FORMAT_CHECK(...)\
+    do\
+    {\
+      for(size_t size_ = 0; size_ <= FORMAT_SIZE_MAX; ++size_)\
+      {\
+        char expected_[FORMAT_SIZE_MAX + 1];\
+        char actual_[FORMAT_SIZE_MAX + 1];\
+        memset(expected_, 0x55, sizeof(expected_));\
+        memset(actual_, 0x55, sizeof(actual_));\
+        int expected_len_ = snprintf(expected_, size_, __VA_ARGS__);\
+        int actual_len_ = eformat_snprintf(actual_, size_, __VA_ARGS__);\
+        if((expected_len_ != actual_len_) || (0 != memcmp(expected_, actual_, sizeof(expected_))))\
+        {\
+          printf("size %zu: %s: \"%.*s\" (%d) != \"%.*s\" (%d)\n", size_, #__VA_ARGS__, (int)size_, expected_,\
+                 expected_len_, (int)size_, actual_, actual_len_);\
+        }\
+        TEST_CHECK(expected_len_ == actual_len_);\
+        TEST_CHECK(0 == memcmp(expected_, actual_, sizeof(expected_)));\
+      }\
+    } while(0)
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+/*
+ * eformat_snprintf() against the C library snprintf(), byte for byte over
+ * the whole buffer (untouched bytes included) and for the return value,
+ * for every supported conversion and every buffer size up to 64.
+ */
+int main(void)
+{
+  FORMAT_CHECK("plain text");
+  FORMAT_CHECK("%%");
+  FORMAT_CHECK("%d %d %d %d", 0, 42, -42, 7);
+  FORMAT_CHECK("%d %i", INT_MIN, INT_MAX);
+  FORMAT_CHECK("%u %u", 0u, UINT_MAX);
+  FORMAT_CHECK("%x %X %x", 0xdeadbeefu, 0xdeadbeefu, 0u);
+  FORMAT_CHECK("%ld %lu %lx", LONG_MIN, ULONG_MAX, 0x1234abcdUL);
+  FORMAT_CHECK("%lld %llu %llx", LLONG_MIN, ULLONG_MAX, 0x123456789abcdefULL);
+  FORMAT_CHECK("[%llu] %s", 18446744073709551615ULL, "log line");
+  FORMAT_CHECK("%s|%s|%s", "", "a", "a longer string that does not fit the small buffers");
+  FORMAT_CHECK("%c%c%c", 'a', ' ', 'z');
+  FORMAT_CHECK("%5d|%-5d|%05d|%05d", 42, 42, 42, -42);
+  FORMAT_CHECK("%8x|%08X|%-8x|", 0xbeefu, 0xbeefu, 0xbeefu);
+  FORMAT_CHECK("%10s|%-10s|%3s", "abc", "abc", "abcdef");
+  FORMAT_CHECK("%*d|%-*d|%0*u", 6, -7, 6, -7, 6, 7u);
+  FORMAT_CHECK("%3c|%-3c|", 'x', 'y');
+  FORMAT_CHECK("%012lld", -1234567890123LL);
+  FORMAT_CHECK("button: debounce sampling overrun, %lu missed", 3UL);
+  FORMAT_CHECK("hsm %lx -> %lu", 0x0102UL, 4UL);
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
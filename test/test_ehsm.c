@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_ehsm.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "eboard.h"
+#include "ehsm.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define TEST_HSM_ID             (0x42)
+
+/********************** internal data declaration ****************************/
+
+typedef enum
+{
+  STATE_TOP,
+  STATE_A,
+  STATE_B,
+  STATE__CNT,
+} state_t;
+
+typedef enum
+{
+  SIG_GO,
+  SIG__CNT,
+} signal_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+static const ehsm_state_t states_[STATE__CNT] =
+{
+  [STATE_TOP] = EHSM_STATE(TOP, EHSM_NONE, NULL, NULL),
+  [STATE_A] = EHSM_STATE(A, STATE_TOP, NULL, NULL),
+  [STATE_B] = EHSM_STATE(B, STATE_TOP, NULL, NULL),
+};
+
+static const ehsm_transition_t transitions_[STATE__CNT][SIG__CNT] =
+{
+  [STATE_A] = {[SIG_GO] = EHSM_TRAN(STATE_B, NULL)},
+};
+
+static const ehsm_def_t def_ = EHSM_DEF("test", states_, transitions_);
+
+static char out_[1024];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+/*
+ * A transition traced by ehsm_trace_flight() lands in the flight recorder:
+ * after a simulated reset it is dumped with the machine id.
+ */
+int main(void)
+{
+  ehsm_t hsm;
+
+  eboard_init();
+  eboard_host_port_uart_take(out_, sizeof(out_));
+
+  ehsm_init(&hsm, &def_, TEST_HSM_ID, STATE_A, NULL, ehsm_trace_flight);
+  TEST_CHECK(ehsm_dispatch(&hsm, SIG_GO, NULL));
+  TEST_CHECK(ehsm_is_in(&hsm, STATE_B));
+  TEST_CHECK(!ehsm_dispatch(&hsm, SIG_GO, NULL));
+
+  // The recorder keeps its RAM, eboard_init() finds the record again
+  eboard_init();
+  eboard_log_flush();
+  eboard_host_port_uart_take(out_, sizeof(out_));
+  printf("%s", out_);
+  TEST_CHECK(NULL != strstr(out_, "flight: hsm 420001 -> 2\r\n"));
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
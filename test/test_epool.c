@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_epool.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "epool.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define TEST_BLOCKS             (40) // More than one map word
+
+/********************** internal data declaration ****************************/
+
+typedef struct
+{
+  uint32_t words[3];
+} test_block_t;
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+// Built with DEBUG, see CMakeLists.txt
+EPOOL_DEFINE(test_pool, test_block_t, TEST_BLOCKS);
+
+static void* blocks_[TEST_BLOCKS];
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+/********************** external functions definition ************************/
+
+int main(void)
+{
+  epool_stats_t stats;
+  test_block_t foreign;
+
+  TEST_CHECK(NULL != test_pool.map);
+  for(size_t i = 0; i < TEST_BLOCKS; ++i)
+  {
+    blocks_[i] = epool_alloc(&test_pool);
+    TEST_CHECK(NULL != blocks_[i]);
+  }
+  TEST_CHECK(NULL == epool_alloc(&test_pool));
+
+  // Double free: the second one is refused, the list is not looped
+  epool_free(&test_pool, blocks_[33]);
+  epool_free(&test_pool, blocks_[33]);
+  epool_stats(&test_pool, &stats);
+  TEST_CHECK(1 == stats.bad_frees);
+  TEST_CHECK((TEST_BLOCKS - 1) == stats.in_use);
+  TEST_CHECK(blocks_[33] == epool_alloc(&test_pool));
+  TEST_CHECK(NULL == epool_alloc(&test_pool));
+
+  // Foreign pointers: outside the pool, inside a block, past the end
+  epool_free(&test_pool, &foreign);
+  epool_free(&test_pool, (uint8_t*)blocks_[0] + 4);
+  epool_free(&test_pool, (uint8_t*)blocks_[0] + (TEST_BLOCKS * test_pool.block_size));
+  epool_stats(&test_pool, &stats);
+  TEST_CHECK(4 == stats.bad_frees);
+  TEST_CHECK(TEST_BLOCKS == stats.in_use);
+  TEST_CHECK(NULL == epool_alloc(&test_pool));
+
+  // Every block still goes back once
+  for(size_t i = 0; i < TEST_BLOCKS; ++i)
+  {
+    epool_free(&test_pool, blocks_[i]);
+  }
+  epool_stats(&test_pool, &stats);
+  TEST_CHECK(4 == stats.bad_frees);
+  TEST_CHECK(0 == stats.in_use);
+  TEST_CHECK(TEST_BLOCKS == stats.peak);
+  TEST_CHECK(3 == stats.fails);
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Sebastian Bedin <sebabedin@gmail.com>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * @file   : test_time.c
+ * @date   : Oct 19, 2026
+ * @author : PW1-A contributors
+ * @version	v1.0.0
+ */
+
+/********************** inclusions *******************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "eboard.h"
+#include "test.h"
+
+/********************** macros and definitions *******************************/
+
+#define TICK_US                 (1000)
+#define LOAD                    (180000) // SysTick counts per tick at 180 MHz
+
+
+/********************** internal data declaration ****************************/
+
+
+/********************** internal functions declaration ***********************/
+
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+
+static void test_sim_(void)
+{
+  eboard_time_sim_set(0);
+  TEST_CHECK(0 == eboard_time_ms());
+  TEST_CHECK(0 == eboard_time_us());
+
+  eboard_time_sim_advance(999);
+  TEST_CHECK(0 == eboard_time_ms());
+  TEST_CHECK(999 == eboard_time_us());
+
+  eboard_time_sim_advance(1);
+  TEST_CHECK(1 == eboard_time_ms());
+
+  // 64 bits: past the 32-bit ms and us wraps
+  eboard_time_sim_set(((uint64_t)UINT32_MAX + 2) * 1000);
+  TEST_CHECK(((uint64_t)UINT32_MAX + 2) == eboard_time_ms());
+  TEST_CHECK(((uint64_t)UINT32_MAX + 2) * 1000 == eboard_time_us());
+}
+
+static void test_ticks_(void)
+{
+  // Reads less than half a wrap apart, as from a boot at 0
+  eboard_time_ext_t ext = {.last = UINT32_MAX - 2};
+
+  // Across the 32-bit wrap of the tick count
+  TEST_CHECK((UINT32_MAX - 1) == eboard_time_ext_ticks(&ext, UINT32_MAX - 1));
+  TEST_CHECK(UINT32_MAX == eboard_time_ext_ticks(&ext, UINT32_MAX));
+  TEST_CHECK(((uint64_t)1 << 32) == eboard_time_ext_ticks(&ext, 0));
+  TEST_CHECK((((uint64_t)1 << 32) + 5) == eboard_time_ext_ticks(&ext, 5));
+
+  // Wrapped between two reads less than half a wrap apart
+  TEST_CHECK((((uint64_t)1 << 32) + 0x70000000u) == eboard_time_ext_ticks(&ext, 0x70000000u));
+  TEST_CHECK((((uint64_t)1 << 32) + 0xe0000000u) == eboard_time_ext_ticks(&ext, 0xe0000000u));
+  TEST_CHECK((((uint64_t)2 << 32) + 3) == eboard_time_ext_ticks(&ext, 3));
+
+  // Behind a read that counted a pending tick, also right after a wrap
+  ext = (eboard_time_ext_t){.last = UINT32_MAX};
+  TEST_CHECK(((uint64_t)1 << 32) == eboard_time_ext_ticks(&ext, 0));
+  TEST_CHECK(((uint64_t)1 << 32) == eboard_time_ext_ticks(&ext, UINT32_MAX));
+  TEST_CHECK((((uint64_t)1 << 32) + 1) == eboard_time_ext_ticks(&ext, 1));
+}
+
+static void test_us_(void)
+{
+  eboard_time_ext_t ext = {.last = UINT32_MAX};
+  uint64_t base = ((uint64_t)1 << 32) * TICK_US;
+
+  // Sub-tick resolution, across the wrap
+  TEST_CHECK((base - TICK_US + 500) == eboard_time_ext_us(&ext, UINT32_MAX, LOAD / 2, LOAD, TICK_US));
+  TEST_CHECK((base + 250) == eboard_time_ext_us(&ext, 0, LOAD / 4, LOAD, TICK_US));
+
+  // A full count of the timer is still inside the tick
+  TEST_CHECK((base + TICK_US - 1) == eboard_time_ext_us(&ext, 0, LOAD, LOAD, TICK_US));
+
+  // Scheduler suspended: the tick count stands still while the timer keeps
+  // wrapping. The time holds instead of stepping back, then moves on with
+  // the ticks counted on resume.
+  uint64_t held = eboard_time_ext_us(&ext, 0, LOAD - 1, LOAD, TICK_US);
+  TEST_CHECK(held == eboard_time_ext_us(&ext, 0, 1, LOAD, TICK_US));
+  TEST_CHECK(held == eboard_time_ext_us(&ext, 0, LOAD / 2, LOAD, TICK_US));
+  TEST_CHECK((base + (3 * TICK_US) + 100) == eboard_time_ext_us(&ext, 3, LOAD / 10, LOAD, TICK_US));
+
+  // Behind a read that counted a pending tick
+  uint64_t pending = eboard_time_ext_us(&ext, 5, 10, LOAD, TICK_US);
+  TEST_CHECK(pending <= eboard_time_ext_us(&ext, 4, LOAD - 1, LOAD, TICK_US));
+  TEST_CHECK(pending <= eboard_time_ext_us(&ext, 5, 20, LOAD, TICK_US));
+
+  // Scheduler not started, no timer
+  ext = (eboard_time_ext_t){0};
+  TEST_CHECK((7 * TICK_US) == eboard_time_ext_us(&ext, 7, 0, 1, TICK_US));
+}
+
+/********************** external functions definition ************************/
+
+int main(void)
+{
+  test_sim_();
+  test_ticks_();
+  test_us_();
+
+  return TEST_RESULT();
+}
+
+/********************** end of file ******************************************/